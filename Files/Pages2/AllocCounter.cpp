@@ -0,0 +1,57 @@
+#include "AllocCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<long> allocations{0};
+    std::atomic<long> frees{0};
+    thread_local long threadAllocations = 0;
+
+#if COUNT_ALLOCS
+    void* allocate(std::size_t size) {
+        allocations.fetch_add(1, std::memory_order_relaxed);
+        ++threadAllocations;
+        if (void* p = std::malloc(size ? size : 1)) {
+            return p;
+        }
+        throw std::bad_alloc();
+    }
+
+    void release(void* p) noexcept {
+        if (p) {
+            frees.fetch_add(1, std::memory_order_relaxed);
+            std::free(p);
+        }
+    }
+#endif
+}
+
+long allocationCount() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+long threadAllocationCount() {
+    return threadAllocations;
+}
+
+long freeCount() {
+    return frees.load(std::memory_order_relaxed);
+}
+
+#if COUNT_ALLOCS
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return allocate(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return allocate(size); } catch (...) { return nullptr; }
+}
+void operator delete(void* p) noexcept { release(p); }
+void operator delete[](void* p) noexcept { release(p); }
+void operator delete(void* p, std::size_t) noexcept { release(p); }
+void operator delete[](void* p, std::size_t) noexcept { release(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { release(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { release(p); }
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+
+// AllocCounter.cpp replaces the global operator new/delete with versions
+// that count every call. AppManager reads the counter around each frame
+// to find frames that touch the heap. With COUNT_ALLOCS 0 (make
+// COUNT_ALLOCS=0) the standard ones stay in place and every count is 0.
+#ifndef COUNT_ALLOCS
+#define COUNT_ALLOCS 1
+#endif
+
+long allocationCount();
+// Only the calling thread's allocations.
+long threadAllocationCount();
+long freeCount();
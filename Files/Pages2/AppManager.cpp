@@ -1,8 +1,19 @@
 #include "AppManager.hpp"
 #include "Page1.hpp"
+#include "Page2.hpp"
+#include "AllocCounter.hpp"
+#include <algorithm>
+#include <iostream>
 
 AppManager::AppManager() : window(sf::VideoMode(800, 600), "Clickable Shapes App") {
-    currentPage = std::make_unique<Page1>();
+    // Page1 keeps its shapes moving between visits; Page2 deals a new
+    // set of shapes every time.
+    registerPage(PageId::Page1, [] { return std::make_unique<Page1>(); }, true);
+    registerPage(PageId::Page2, [] { return std::make_unique<Page2>(); }, false);
+
+    currentId = PageId::Page1;
+    currentPage = takePage(pages[currentId]);
+    currentPage->onEnter(window);
 }
 
 AppManager& AppManager::getInstance() {
@@ -10,26 +21,93 @@ AppManager& AppManager::getInstance() {
     return instance;
 }
 
-void AppManager::run() {
+void AppManager::registerPage(PageId id, std::function<std::unique_ptr<Page>()> build, bool keep) {
+    PageSlot& slot = pages[id];
+    slot.build = std::move(build);
+    slot.keep = keep;
+    slot.upcoming = std::async(std::launch::async, slot.build);
+}
+
+Page* AppManager::takePage(PageSlot& slot) {
+    if (!slot.instance) {
+        slot.instance = slot.upcoming.get();
+        if (!slot.keep) {
+            slot.upcoming = std::async(std::launch::async, slot.build);
+        }
+    }
+    return slot.instance.get();
+}
+
+long AppManager::run(long maxFrames, long warmupFrames) {
+    long frames = 0, allocatingFrames = 0, strayAllocations = 0;
     while (window.isOpen()) {
+        // Only this thread's allocations: pages being built in the
+        // background aren't part of the frame.
+        long allocsBefore = threadAllocationCount();
+        long changesBefore = pageChanges;
+
         sf::Event event;
         while (window.pollEvent(event)) {
             if (event.type == sf::Event::Closed)
                 window.close();
 
             currentPage->handleEvent(event, window);
+            applyPageChange();
         }
 
-        currentPage->update();
+        currentPage->update(window.getSize());
 
         window.clear(sf::Color::White);
         currentPage->draw(window);
         window.display();
+
+        // A page change hands a fresh page's build to a new thread, so
+        // it's expected to allocate; any other warm frame that does is a
+        // leak in the budget.
+        long allocs = threadAllocationCount() - allocsBefore;
+        if (++frames > warmupFrames && allocs > 0 && pageChanges == changesBefore) {
+            allocatingFrames++;
+            strayAllocations += allocs;
+        }
+        if (maxFrames > 0 && frames >= maxFrames) {
+            window.close();
+        }
+    }
+
+    std::cout << "frames: " << frames << ", warm frames that allocated: " << allocatingFrames
+              << " (" << strayAllocations << " allocations)" << std::endl;
+    if (pageChanges > 0) {
+        std::cout << "page switches: " << pageChanges << ", latency mean "
+                  << totalSwitchMicros / pageChanges << " us, max " << maxSwitchMicros << " us" << std::endl;
     }
+    return allocatingFrames;
+}
+
+void AppManager::changePage(PageId id) {
+    changeRequested = true;
+    requestedId = id;
+    requestTime = std::chrono::steady_clock::now();
 }
 
-void AppManager::changePage(std::unique_ptr<Page> newPage) {
-    currentPage = std::move(newPage);
+void AppManager::applyPageChange() {
+    if (!changeRequested) {
+        return;
+    }
+    changeRequested = false;
+
+    PageSlot& from = pages[currentId];
+    if (!from.keep) {
+        from.instance.reset();
+    }
+    currentId = requestedId;
+    currentPage = takePage(pages[currentId]);
+    currentPage->onEnter(window);
+
+    double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - requestTime).count();
+    totalSwitchMicros += micros;
+    maxSwitchMicros = std::max(maxSwitchMicros, micros);
+    pageChanges++;
+    std::cout << "page switch: " << micros << " us" << std::endl;
 }
 
 sf::RenderWindow& AppManager::getWindow() {
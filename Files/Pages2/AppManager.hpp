@@ -1,20 +1,60 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <map>
 #include <memory>
 
 class Page;
 
+// Every page the app can show. AppManager owns the pages; the pages
+// only ever ask for one of these by name.
+enum class PageId { Page1, Page2 };
+
 class AppManager {
 private:
+    // How to get one page. A kept page is built once and comes back as
+    // it was left; the others start fresh on every visit. Either way the
+    // next instance is built on a background thread before it's asked for.
+    struct PageSlot {
+        std::function<std::unique_ptr<Page>()> build;
+        bool keep = false;
+        std::unique_ptr<Page> instance;              // built and in use (or kept)
+        std::future<std::unique_ptr<Page>> upcoming; // being built for the next visit
+    };
+
     sf::RenderWindow window;
-    std::unique_ptr<Page> currentPage;
+    std::map<PageId, PageSlot> pages;
+    PageId currentId = PageId::Page1;
+    Page* currentPage = nullptr;
+
+    bool changeRequested = false;
+    PageId requestedId = PageId::Page1;
+    std::chrono::steady_clock::time_point requestTime;
+
+    long pageChanges = 0;
+    double totalSwitchMicros = 0, maxSwitchMicros = 0;
 
     AppManager(); // Private constructor for Singleton
 
+    // build runs on another thread, so it mustn't call getInstance().
+    void registerPage(PageId id, std::function<std::unique_ptr<Page>()> build, bool keep);
+    // Hands over slot's next instance, starting on the one after if the
+    // page isn't kept. Waits if the background build isn't done yet.
+    Page* takePage(PageSlot& slot);
+    // Performs a changePage() request, if there is one.
+    void applyPageChange();
+
 public:
     static AppManager& getInstance(); // Singleton access
 
-    void run();
-    void changePage(std::unique_ptr<Page> newPage);
+    // Runs until the window closes, or for maxFrames frames if that's
+    // positive. Returns how many frames after the first warmupFrames
+    // allocated on the heap without a page change to explain it.
+    long run(long maxFrames = 0, long warmupFrames = 60);
+    // Switches to page id once the current event handler returns, so the
+    // page that asked is never destroyed while it's still running.
+    void changePage(PageId id);
     sf::RenderWindow& getWindow();
 };
@@ -0,0 +1,54 @@
+#include "AssetCache.hpp"
+#include <map>
+#include <mutex>
+
+namespace {
+    // Pages are built on a background thread, so the caches are shared.
+    std::mutex cacheMutex;
+
+    // The cache keeps its own reference, so an asset outlives the page
+    // that first asked for it until trimAssets() lets it go.
+    template <typename T>
+    std::map<std::string, std::shared_ptr<T>>& cacheFor() {
+        static std::map<std::string, std::shared_ptr<T>> cache;
+        return cache;
+    }
+
+    template <typename T>
+    std::shared_ptr<const T> load(const std::string& path) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto& cache = cacheFor<T>();
+        auto it = cache.find(path);
+        if (it != cache.end()) {
+            return it->second;
+        }
+        // On failure the empty asset is cached anyway, so a missing file
+        // is reported once by SFML instead of on every page switch.
+        auto asset = std::make_shared<T>();
+        asset->loadFromFile(path);
+        cache[path] = asset;
+        return asset;
+    }
+
+    template <typename T>
+    void trim() {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto& cache = cacheFor<T>();
+        for (auto it = cache.begin(); it != cache.end();) {
+            it = (it->second.use_count() <= 1) ? cache.erase(it) : std::next(it);
+        }
+    }
+}
+
+std::shared_ptr<const sf::Font> loadFont(const std::string& path) {
+    return load<sf::Font>(path);
+}
+
+std::shared_ptr<const sf::Texture> loadTexture(const std::string& path) {
+    return load<sf::Texture>(path);
+}
+
+void trimAssets() {
+    trim<sf::Font>();
+    trim<sf::Texture>();
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+
+// Process-wide font/texture cache keyed by path. The first call for a
+// path reads the file; later calls (e.g. every time a fresh page is
+// built) get the same object back without touching the disk. Safe to
+// call from any thread.
+// Never null: a file that couldn't be loaded gives an empty asset, just
+// like a failed loadFromFile on a member would.
+std::shared_ptr<const sf::Font> loadFont(const std::string& path);
+std::shared_ptr<const sf::Texture> loadTexture(const std::string& path);
+
+// Frees every cached asset no page is currently holding.
+void trimAssets();
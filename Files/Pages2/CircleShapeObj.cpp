@@ -4,6 +4,7 @@ CircleShapeObj::CircleShapeObj(float radius, sf::Color color, sf::Vector2f pos)
     : circle(radius) {
     circle.setFillColor(color);
     circle.setPosition(pos);
+    localBounds = circle.getLocalBounds();
 }
 
 void CircleShapeObj::draw(sf::RenderWindow& window) const {
@@ -17,7 +18,3 @@ void CircleShapeObj::setPosition(sf::Vector2f pos) {
 sf::Vector2f CircleShapeObj::getPosition() const {
     return circle.getPosition();
 }
-
-sf::FloatRect CircleShapeObj::getBounds() const {
-    return circle.getGlobalBounds();
-}
@@ -0,0 +1,163 @@
+#include "Collision.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    // A box or triangle as points plus the edge normals to test along
+    // (a box only needs two, since opposite edges are parallel).
+    struct Polygon {
+        sf::Vector2f points[4];
+        sf::Vector2f axes[3];
+        int pointCount = 0;
+        int axisCount = 0;
+    };
+
+    float dot(sf::Vector2f a, sf::Vector2f b) {
+        return a.x * b.x + a.y * b.y;
+    }
+
+    sf::Vector2f unit(sf::Vector2f v) {
+        float length = std::sqrt(dot(v, v));
+        return length > 0.f ? v / length : sf::Vector2f(1.f, 0.f);
+    }
+
+    sf::Vector2f center(const Body& b) {
+        return b.topLeft + b.size * 0.5f;
+    }
+
+    Polygon makePolygon(const Body& b, ColliderKind kind) {
+        float left = b.topLeft.x, top = b.topLeft.y;
+        float right = left + b.size.x, bottom = top + b.size.y;
+        Polygon p;
+        if (kind == ColliderKind::Triangle) {
+            // Same outline as TriangleShapeObj: apex at the top middle,
+            // flat base along the bottom.
+            p.points[0] = sf::Vector2f((left + right) * 0.5f, top);
+            p.points[1] = sf::Vector2f(right, bottom);
+            p.points[2] = sf::Vector2f(left, bottom);
+            p.pointCount = 3;
+            for (int i = 0; i < 3; ++i) {
+                sf::Vector2f edge = p.points[(i + 1) % 3] - p.points[i];
+                p.axes[i] = unit(sf::Vector2f(edge.y, -edge.x));
+            }
+            p.axisCount = 3;
+        }
+        else {
+            p.points[0] = sf::Vector2f(left, top);
+            p.points[1] = sf::Vector2f(right, top);
+            p.points[2] = sf::Vector2f(right, bottom);
+            p.points[3] = sf::Vector2f(left, bottom);
+            p.pointCount = 4;
+            p.axes[0] = sf::Vector2f(1.f, 0.f);
+            p.axes[1] = sf::Vector2f(0.f, 1.f);
+            p.axisCount = 2;
+        }
+        return p;
+    }
+
+    void project(const Polygon& p, sf::Vector2f axis, float& lo, float& hi) {
+        lo = hi = dot(p.points[0], axis);
+        for (int i = 1; i < p.pointCount; ++i) {
+            float d = dot(p.points[i], axis);
+            lo = std::min(lo, d);
+            hi = std::max(hi, d);
+        }
+    }
+
+    // False if axis separates the two intervals; otherwise keeps it in
+    // contact when it's the shallowest overlap seen so far.
+    bool overlapOn(sf::Vector2f axis, float loA, float hiA, float loB, float hiB, Contact& contact) {
+        float depth = std::min(hiA - loB, hiB - loA);
+        if (depth <= 0.f) {
+            return false;
+        }
+        if (depth < contact.depth) {
+            contact.depth = depth;
+            contact.normal = axis;
+        }
+        return true;
+    }
+
+    bool polygonContact(const Polygon& a, const Polygon& b, Contact& contact) {
+        const Polygon* both[2] = { &a, &b };
+        for (const Polygon* owner : both) {
+            for (int i = 0; i < owner->axisCount; ++i) {
+                float loA, hiA, loB, hiB;
+                project(a, owner->axes[i], loA, hiA);
+                project(b, owner->axes[i], loB, hiB);
+                if (!overlapOn(owner->axes[i], loA, hiA, loB, hiB, contact)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool circleContact(sf::Vector2f c, float radius, const Polygon& p, Contact& contact) {
+        // Besides the polygon's own normals, the only axis that can
+        // separate it from a circle runs through its nearest corner.
+        sf::Vector2f nearest = p.points[0];
+        for (int i = 1; i < p.pointCount; ++i) {
+            sf::Vector2f d = c - p.points[i], best = c - nearest;
+            if (dot(d, d) < dot(best, best)) {
+                nearest = p.points[i];
+            }
+        }
+        sf::Vector2f axes[4] = { unit(c - nearest) };
+        std::copy(p.axes, p.axes + p.axisCount, axes + 1);
+        for (int i = 0; i <= p.axisCount; ++i) {
+            float lo, hi;
+            project(p, axes[i], lo, hi);
+            float middle = dot(c, axes[i]);
+            if (!overlapOn(axes[i], middle - radius, middle + radius, lo, hi, contact)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+bool findContact(const Body& a, ColliderKind kindA, const Body& b, ColliderKind kindB, Contact& contact) {
+    if (a.topLeft.x >= b.topLeft.x + b.size.x || b.topLeft.x >= a.topLeft.x + a.size.x ||
+        a.topLeft.y >= b.topLeft.y + b.size.y || b.topLeft.y >= a.topLeft.y + a.size.y) {
+        return false;
+    }
+    sf::Vector2f between = center(b) - center(a);
+    contact.depth = std::numeric_limits<float>::max();
+    bool hit;
+    if (kindA == ColliderKind::Circle && kindB == ColliderKind::Circle) {
+        float reach = (a.size.x + b.size.x) * 0.5f;
+        float distance = std::sqrt(dot(between, between));
+        hit = distance < reach;
+        contact.normal = unit(between);
+        contact.depth = reach - distance;
+    }
+    else if (kindA == ColliderKind::Circle) {
+        hit = circleContact(center(a), a.size.x * 0.5f, makePolygon(b, kindB), contact);
+    }
+    else if (kindB == ColliderKind::Circle) {
+        hit = circleContact(center(b), b.size.x * 0.5f, makePolygon(a, kindA), contact);
+    }
+    else {
+        hit = polygonContact(makePolygon(a, kindA), makePolygon(b, kindB), contact);
+    }
+    // The axes above have no particular direction; point it from a to b.
+    if (dot(contact.normal, between) < 0.f) {
+        contact.normal = -contact.normal;
+    }
+    return hit;
+}
+
+void resolveContact(Body& a, Body& b, const Contact& contact) {
+    sf::Vector2f push = contact.normal * (contact.depth * 0.5f);
+    a.topLeft -= push;
+    b.topLeft += push;
+
+    float closing = dot(a.velocity - b.velocity, contact.normal);
+    if (closing > 0.f) {
+        sf::Vector2f exchange = contact.normal * closing;
+        a.velocity -= exchange;
+        b.velocity += exchange;
+    }
+}
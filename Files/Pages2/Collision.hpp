@@ -0,0 +1,20 @@
+#pragma once
+#include "Shape.hpp"
+
+// How two overlapping bodies have to move apart: normal is a unit vector
+// pointing from the first body towards the second, depth how far they
+// overlap along it.
+struct Contact {
+    sf::Vector2f normal;
+    float depth;
+};
+
+// Exact overlap test between two outlines (circle/circle, circle/polygon
+// or polygon/polygon by separating axes), after a quick bounds check.
+// Fills contact and returns true if they overlap.
+bool findContact(const Body& a, ColliderKind kindA, const Body& b, ColliderKind kindB, Contact& contact);
+
+// Pushes a and b apart along the contact and, if they're still moving
+// towards each other, swaps their velocities along the normal (equal
+// masses, perfectly elastic).
+void resolveContact(Body& a, Body& b, const Contact& contact);
@@ -6,7 +6,14 @@ class AppManager; // Forward declaration
 class Page {
 public:
     virtual void handleEvent(sf::Event& event, sf::RenderWindow& window) = 0;
-    virtual void update() = 0;
+    // windowSize is passed in rather than read from the window, so a
+    // page can be stepped without one.
+    virtual void update(sf::Vector2u windowSize) = 0;
     virtual void draw(sf::RenderWindow& window) = 0;
+
+    // Called on the main thread each time the page comes on screen,
+    // which for a kept page is many times over its life. Pages are built
+    // on a background thread, so anything that needs the window goes here.
+    virtual void onEnter(sf::RenderWindow&) {}
     virtual ~Page() = default;
 };
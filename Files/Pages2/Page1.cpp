@@ -1,6 +1,6 @@
 #include "Page1.hpp"
 #include "AppManager.hpp"
-#include "Page2.hpp"
+#include "AssetCache.hpp"
 #include "ShapeFactory.hpp"
 
 namespace {
@@ -8,23 +8,24 @@ namespace {
 }
 
 Page1::Page1() {
-    font.loadFromFile("arial.ttf");
+    font = loadFont("arial.ttf");
 
-    nextBtn.setFont(font);
+    nextBtn.setFont(*font);
     nextBtn.setString("Next Page");
     nextBtn.setCharacterSize(24);
     nextBtn.setFillColor(sf::Color::Black);
     nextBtn.setPosition(100, 500);
 
-    quitBtn.setFont(font);
+    quitBtn.setFont(*font);
     quitBtn.setString("Quit");
     quitBtn.setCharacterSize(24);
     quitBtn.setFillColor(sf::Color::Black);
     quitBtn.setPosition(300, 500);
 
+    objects.reserve(NUM_SHAPES);
     for (int i = 0; i < NUM_SHAPES; ++i) {
         sf::Vector2f pos(50.f + 100.f * i, 200.f);
-        objects.push_back(createRandomShape(pos, randomVelocity()));
+        addRandomShape(objects, pos, randomVelocity());
     }
 }
 
@@ -37,7 +38,7 @@ void Page1::handleEvent(sf::Event& event, sf::RenderWindow& window) {
         event.mouseButton.button == sf::Mouse::Left) {
         auto mousePos = window.mapPixelToCoords({ event.mouseButton.x, event.mouseButton.y });
         if (isClicked(nextBtn, mousePos)) {
-            AppManager::getInstance().changePage(std::make_unique<Page2>());
+            AppManager::getInstance().changePage(PageId::Page2);
         }
         else if (isClicked(quitBtn, mousePos)) {
             window.close();
@@ -45,17 +46,19 @@ void Page1::handleEvent(sf::Event& event, sf::RenderWindow& window) {
     }
 }
 
-void Page1::update() {
-    sf::Vector2u size = AppManager::getInstance().getWindow().getSize();
-    for (auto& obj : objects) {
-        obj->bounce(size.x, size.y);
-    }
+void Page1::onEnter(sf::RenderWindow& window) {
+    // Built off the main thread, before the window's size was known.
+    sf::Vector2u size = window.getSize();
+    objects.fitWindow(size.x, size.y);
+}
+
+void Page1::update(sf::Vector2u windowSize) {
+    objects.bounceAll(windowSize.x, windowSize.y);
+    objects.collideAll(windowSize.x, windowSize.y);
 }
 
 void Page1::draw(sf::RenderWindow& window) {
-    for (auto& obj : objects) {
-        obj->draw(window);
-    }
+    objects.drawAll(window);
     window.draw(nextBtn);
     window.draw(quitBtn);
 }
@@ -1,21 +1,22 @@
 #pragma once
 #include "Page.hpp"
-#include "Shape.hpp"
+#include "ShapeStore.hpp"
 #include <vector>
 #include <memory>
 #include <SFML/Graphics.hpp>
 
 class Page1 : public Page {
 private:
-    sf::Font font;
+    std::shared_ptr<const sf::Font> font; // shared by every page via AssetCache
     sf::Text nextBtn, quitBtn;
-    std::vector<std::unique_ptr<Shape>> objects;
+    ShapeStore objects;
 
     bool isClicked(const sf::Text& btn, sf::Vector2f mousePos);
 
 public:
     Page1();
     void handleEvent(sf::Event& event, sf::RenderWindow& window) override;
-    void update() override;
+    void onEnter(sf::RenderWindow& window) override;
+    void update(sf::Vector2u windowSize) override;
     void draw(sf::RenderWindow& window) override;
 };
@@ -1,28 +1,30 @@
 #include "Page2.hpp"
 #include "AppManager.hpp"
-#include "Page1.hpp"
+#include "AssetCache.hpp"
 #include "ShapeFactory.hpp"
-#include <cstdlib>
+#include "Random.hpp"
 
 namespace {
     int randomShapeCount() {
-        return 5 + (rand() % 11); // 5-15 inclusive
+        return threadRng().range(5, 15); // 5-15 inclusive
     }
 }
 
 Page2::Page2() {
-    font.loadFromFile("arial.ttf");
+    font = loadFont("arial.ttf");
 
-    backBtn.setFont(font);
+    backBtn.setFont(*font);
     backBtn.setString("Back");
     backBtn.setCharacterSize(24);
     backBtn.setFillColor(sf::Color::Black);
     backBtn.setPosition(100, 500);
 
     int count = randomShapeCount();
+    shapes.reserve(count);
     for (int i = 0; i < count; ++i) {
-        sf::Vector2f pos(50.f + (rand() % 650), 50.f + (rand() % 400));
-        shapes.push_back(createRandomShape(pos, randomVelocity()));
+        Rng& rng = threadRng();
+        sf::Vector2f pos(50.f + rng.range(0, 649), 50.f + rng.range(0, 399));
+        addRandomShape(shapes, pos, randomVelocity());
     }
 }
 
@@ -39,33 +41,29 @@ void Page2::handleEvent(sf::Event& event, sf::RenderWindow& window) {
     auto mousePos = window.mapPixelToCoords({ event.mouseButton.x, event.mouseButton.y });
 
     if (isClicked(backBtn, mousePos)) {
-        AppManager::getInstance().changePage(std::make_unique<Page1>());
-        return; // this Page2 has just been destroyed; touch nothing else
+        AppManager::getInstance().changePage(PageId::Page1);
+        return;
     }
 
-    for (auto it = shapes.begin(); it != shapes.end(); ++it) {
-        if ((*it)->isClicked(mousePos)) {
-            shapes.erase(it);
-            break;
-        }
-    }
+    shapes.removeAt(mousePos);
 
     if (shapes.empty()) {
-        AppManager::getInstance().changePage(std::make_unique<Page1>());
-        return; // this Page2 has just been destroyed; touch nothing else
+        AppManager::getInstance().changePage(PageId::Page1);
     }
 }
 
-void Page2::update() {
-    sf::Vector2u size = AppManager::getInstance().getWindow().getSize();
-    for (auto& shape : shapes) {
-        shape->bounce(size.x, size.y);
-    }
+void Page2::onEnter(sf::RenderWindow& window) {
+    // Built off the main thread, before the window's size was known.
+    sf::Vector2u size = window.getSize();
+    shapes.fitWindow(size.x, size.y);
+}
+
+void Page2::update(sf::Vector2u windowSize) {
+    shapes.bounceAll(windowSize.x, windowSize.y);
+    shapes.collideAll(windowSize.x, windowSize.y);
 }
 
 void Page2::draw(sf::RenderWindow& window) {
-    for (auto& s : shapes) {
-        s->draw(window);
-    }
+    shapes.drawAll(window);
     window.draw(backBtn);
 }
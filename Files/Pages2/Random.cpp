@@ -0,0 +1,35 @@
+#include "Random.hpp"
+#include <atomic>
+
+namespace {
+    std::atomic<uint64_t> baseSeed{0};
+    std::atomic<uint64_t> nextStream{0};
+}
+
+Rng::Rng(uint64_t seed, uint64_t stream)
+    : state(0), inc((stream << 1u) | 1u) {
+    next();
+    state += seed;
+    next();
+}
+
+void Rng::fill(int* out, int count, int lo, int hi) {
+    for (int i = 0; i < count; ++i) {
+        out[i] = range(lo, hi);
+    }
+}
+
+void Rng::fill(float* out, int count, float lo, float hi) {
+    for (int i = 0; i < count; ++i) {
+        out[i] = uniform(lo, hi);
+    }
+}
+
+void seedRandom(uint64_t seed) {
+    baseSeed = seed;
+}
+
+Rng& threadRng() {
+    thread_local Rng rng(baseSeed, nextStream++);
+    return rng;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <cstdint>
+
+// Small PCG32 generator. Each instance has its own state, so unlike
+// rand() two generators never disturb each other and they're safe to
+// use from different threads.
+class Rng {
+private:
+    uint64_t state;
+    uint64_t inc; // must be odd; picks one of 2^63 independent streams
+
+public:
+    explicit Rng(uint64_t seed = 0, uint64_t stream = 0);
+
+    uint32_t next() {
+        uint64_t old = state;
+        state = old * 6364136223846793005ULL + inc;
+        uint32_t xorshifted = static_cast<uint32_t>(((old >> 18u) ^ old) >> 27u);
+        uint32_t rot = static_cast<uint32_t>(old >> 59u);
+        return (xorshifted >> rot) | (xorshifted << ((32u - rot) & 31u));
+    }
+
+    // lo..hi inclusive
+    int range(int lo, int hi) {
+        uint64_t span = static_cast<uint64_t>(hi - lo + 1);
+        return lo + static_cast<int>((next() * span) >> 32);
+    }
+
+    // [lo, hi)
+    float uniform(float lo, float hi) {
+        return lo + (next() >> 8) * (1.f / 16777216.f) * (hi - lo);
+    }
+
+    // Bulk versions, for filling a whole batch at once.
+    void fill(int* out, int count, int lo, int hi);
+    void fill(float* out, int count, float lo, float hi);
+};
+
+// Sets the seed every thread's generator is derived from. Call once at
+// startup, before the first threadRng().
+void seedRandom(uint64_t seed);
+
+// This thread's own generator: the seed from seedRandom() on a stream
+// no other thread uses.
+Rng& threadRng();
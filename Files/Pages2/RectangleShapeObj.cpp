@@ -4,6 +4,7 @@ RectangleShapeObj::RectangleShapeObj(sf::Vector2f size, sf::Color color, sf::Vec
     : rectangle(size) {
     rectangle.setFillColor(color);
     rectangle.setPosition(pos);
+    localBounds = rectangle.getLocalBounds();
 }
 
 void RectangleShapeObj::draw(sf::RenderWindow& window) const {
@@ -17,7 +18,3 @@ void RectangleShapeObj::setPosition(sf::Vector2f pos) {
 sf::Vector2f RectangleShapeObj::getPosition() const {
     return rectangle.getPosition();
 }
-
-sf::FloatRect RectangleShapeObj::getBounds() const {
-    return rectangle.getGlobalBounds();
-}
@@ -8,20 +8,44 @@ sf::Vector2f Shape::getVelocity() const {
     return velocity;
 }
 
-bool Shape::isClicked(sf::Vector2f mousePos) const {
-    return getBounds().contains(mousePos);
+sf::FloatRect Shape::getBounds() const {
+    sf::Vector2f pos = getPosition();
+    return sf::FloatRect(pos.x + localBounds.left, pos.y + localBounds.top,
+                         localBounds.width, localBounds.height);
 }
 
-void Shape::bounce(unsigned windowWidth, unsigned windowHeight) {
+Body Shape::getBody() const {
     sf::FloatRect bounds = getBounds();
-    sf::Vector2f nextTopLeft(bounds.left + velocity.x, bounds.top + velocity.y);
+    return Body{ sf::Vector2f(bounds.left, bounds.top), sf::Vector2f(bounds.width, bounds.height), velocity };
+}
 
-    if (nextTopLeft.x < 0 || nextTopLeft.x + bounds.width > windowWidth) {
-        velocity.x = -velocity.x;
-    }
-    if (nextTopLeft.y < 0 || nextTopLeft.y + bounds.height > windowHeight) {
-        velocity.y = -velocity.y;
+void Shape::setBody(const Body& body) {
+    velocity = body.velocity;
+    setPosition(body.topLeft - sf::Vector2f(localBounds.left, localBounds.top));
+}
+
+void bounceAll(Body* bodies, std::size_t count, unsigned windowWidth, unsigned windowHeight) {
+    const float width = static_cast<float>(windowWidth);
+    const float height = static_cast<float>(windowHeight);
+    for (std::size_t i = 0; i < count; ++i) {
+        Body& b = bodies[i];
+        float nextX = b.topLeft.x + b.velocity.x;
+        float nextY = b.topLeft.y + b.velocity.y;
+        bool flipX = (nextX < 0) | (nextX + b.size.x > width);
+        bool flipY = (nextY < 0) | (nextY + b.size.y > height);
+        b.velocity.x = flipX ? -b.velocity.x : b.velocity.x;
+        b.velocity.y = flipY ? -b.velocity.y : b.velocity.y;
+        b.topLeft.x += b.velocity.x;
+        b.topLeft.y += b.velocity.y;
     }
+}
+
+bool Shape::isClicked(sf::Vector2f mousePos) const {
+    return getBounds().contains(mousePos);
+}
 
-    setPosition(getPosition() + velocity);
+void Shape::bounce(unsigned windowWidth, unsigned windowHeight) {
+    Body body = getBody();
+    bounceAll(&body, 1, windowWidth, windowHeight);
+    setBody(body);
 }
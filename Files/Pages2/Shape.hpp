@@ -1,5 +1,24 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <cstddef>
+
+// Everything bounce() needs about a shape: its on-screen bounds and its
+// velocity. Plain floats, so an array of them can be moved in one tight
+// loop (bounceAll) without touching the SFML shapes at all.
+struct Body {
+    sf::Vector2f topLeft;
+    sf::Vector2f size;
+    sf::Vector2f velocity;
+};
+
+// The outline a body collides as, inside its bounds: the circle or
+// triangle that fills them, or the whole box.
+enum class ColliderKind { Circle, Box, Triangle };
+
+// Bounces count bodies in one pass: the same step as Shape::bounce,
+// written without per-shape calls or data-dependent branches so the
+// compiler can vectorise it.
+void bounceAll(Body* bodies, std::size_t count, unsigned windowWidth, unsigned windowHeight);
 
 // Abstract base for every clickable, movable shape on screen.
 // Subclasses only need to say how to draw/position themselves;
@@ -8,6 +27,9 @@
 class Shape {
 protected:
     sf::Vector2f velocity;
+    // Bounds relative to getPosition(). Set once by each subclass's
+    // constructor; shapes never rotate or scale, so it never changes.
+    sf::FloatRect localBounds;
 
 public:
     virtual ~Shape() = default;
@@ -15,7 +37,14 @@ public:
     virtual void draw(sf::RenderWindow& window) const = 0;
     virtual void setPosition(sf::Vector2f pos) = 0;
     virtual sf::Vector2f getPosition() const = 0;
-    virtual sf::FloatRect getBounds() const = 0;
+
+    // Position plus the cached local bounds: no vertex transforms.
+    sf::FloatRect getBounds() const;
+
+    // This shape's bounds and velocity as a Body, and the reverse:
+    // move the shape to where body says and take its velocity.
+    Body getBody() const;
+    void setBody(const Body& body);
 
     void setVelocity(sf::Vector2f v);
     sf::Vector2f getVelocity() const;
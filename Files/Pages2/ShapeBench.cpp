@@ -0,0 +1,171 @@
+// Benchmark, not part of the app: `make bench` builds and runs it.
+// Bounces the same 100k random shapes stored the old way (a vector of
+// unique_ptr<Shape>, one virtual call chain per shape) and in a
+// ShapeStore (per-type vectors, static dispatch), and reports the time
+// per frame for each. Then steps 10k shapes with shape-to-shape
+// collision on, through the grid and by testing every pair. Last,
+// clicks on 100k shapes spread as thinly: a scan and erase over the
+// pointers against ShapeStore::removeAt().
+#include "ShapeFactory.hpp"
+#include "Random.hpp"
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace {
+    const int NUM_SHAPES = 100000;
+    const int FRAMES = 100;
+    const unsigned WIDTH = 800, HEIGHT = 600;
+
+    // Big enough that 10k shapes cover about a third of it; packed into
+    // 800x600 they'd overlap fifty deep and never settle.
+    const int COLLIDE_SHAPES = 10000;
+    const unsigned WORLD_WIDTH = 10000, WORLD_HEIGHT = 7500;
+
+    const int CLICKS = 1000;
+    const unsigned CLICK_WIDTH = 32000, CLICK_HEIGHT = 24000;
+
+    double millisSince(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    sf::Vector2f randomPos(Rng& rng) {
+        return sf::Vector2f(50.f + rng.range(0, 649), 50.f + rng.range(0, 399));
+    }
+
+    sf::Vector2f randomWorldPos(Rng& rng, unsigned width, unsigned height) {
+        return sf::Vector2f(static_cast<float>(rng.range(0, width - 80)),
+                            static_cast<float>(rng.range(0, height - 80)));
+    }
+}
+
+int main() {
+    // Both layouts start from the same generator state, so they get
+    // identical shapes.
+    threadRng() = Rng(1);
+    std::vector<std::unique_ptr<Shape>> pointers;
+    {
+        Rng posRng(2);
+        for (int i = 0; i < NUM_SHAPES; ++i) {
+            pointers.push_back(createRandomShape(randomPos(posRng), randomVelocity()));
+        }
+    }
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < FRAMES; ++f) {
+        for (auto& s : pointers) {
+            s->bounce(WIDTH, HEIGHT);
+        }
+    }
+    double pointerMs = millisSince(start) / FRAMES;
+
+    threadRng() = Rng(1);
+    ShapeStore store;
+    store.reserve(NUM_SHAPES);
+    {
+        Rng posRng(2);
+        for (int i = 0; i < NUM_SHAPES; ++i) {
+            addRandomShape(store, randomPos(posRng), randomVelocity());
+        }
+    }
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < FRAMES; ++f) {
+        store.bounceAll(WIDTH, HEIGHT);
+    }
+    double storeMs = millisSince(start) / FRAMES;
+
+    std::cout << NUM_SHAPES << " shapes, " << FRAMES << " frames\n";
+    std::cout << "  vector<unique_ptr<Shape>>: " << pointerMs << " ms/frame\n";
+    std::cout << "  ShapeStore:                " << storeMs << " ms/frame\n";
+
+    threadRng() = Rng(3);
+    ShapeStore crowd;
+    crowd.reserve(COLLIDE_SHAPES);
+    {
+        Rng posRng(4);
+        for (int i = 0; i < COLLIDE_SHAPES; ++i) {
+            sf::Vector2f pos = randomWorldPos(posRng, WORLD_WIDTH, WORLD_HEIGHT);
+            addRandomShape(crowd, pos, randomVelocity());
+        }
+    }
+    // The first frames push apart everything that started overlapping;
+    // time the steady state after that.
+    for (int f = 0; f < FRAMES; ++f) {
+        crowd.bounceAll(WORLD_WIDTH, WORLD_HEIGHT);
+        crowd.collideAll(WORLD_WIDTH, WORLD_HEIGHT);
+    }
+    // Both ways start from the same settled shapes.
+    ShapeStore everyPair = crowd;
+    std::size_t contacts = 0;
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < FRAMES; ++f) {
+        crowd.bounceAll(WORLD_WIDTH, WORLD_HEIGHT);
+        contacts += crowd.collideAll(WORLD_WIDTH, WORLD_HEIGHT);
+    }
+    double collideMs = millisSince(start) / FRAMES;
+
+    const int NAIVE_FRAMES = 5;
+    std::size_t naiveContacts = 0;
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < NAIVE_FRAMES; ++f) {
+        everyPair.bounceAll(WORLD_WIDTH, WORLD_HEIGHT);
+        naiveContacts += everyPair.collideEveryPair(WORLD_WIDTH, WORLD_HEIGHT);
+    }
+    double naiveMs = millisSince(start) / NAIVE_FRAMES;
+
+    std::cout << COLLIDE_SHAPES << " shapes colliding in " << WORLD_WIDTH << "x" << WORLD_HEIGHT << "\n";
+    std::cout << "  bounce + grid collision:   " << collideMs << " ms/frame, "
+              << contacts / FRAMES << " contacts/frame\n";
+    std::cout << "  bounce + every pair:       " << naiveMs << " ms/frame, "
+              << naiveContacts / NAIVE_FRAMES << " contacts/frame\n";
+
+    threadRng() = Rng(6);
+    std::vector<std::unique_ptr<Shape>> clickPointers;
+    ShapeStore clickStore;
+    clickStore.reserve(NUM_SHAPES);
+    {
+        Rng posRng(7);
+        for (int i = 0; i < NUM_SHAPES; ++i) {
+            sf::Vector2f pos = randomWorldPos(posRng, CLICK_WIDTH, CLICK_HEIGHT);
+            sf::Vector2f velocity = randomVelocity();
+            Rng before = threadRng(); // the same shape in both
+            clickPointers.push_back(createRandomShape(pos, velocity));
+            threadRng() = before;
+            addRandomShape(clickStore, pos, velocity);
+        }
+    }
+    clickStore.bounceAll(CLICK_WIDTH, CLICK_HEIGHT);
+    for (auto& s : clickPointers) {
+        s->bounce(CLICK_WIDTH, CLICK_HEIGHT);
+    }
+
+    // Page2's old click: first shape whose bounds hold the point, then
+    // erase, which shifts everything after it.
+    Rng clickRng(8);
+    std::size_t scanRemoved = 0;
+    start = std::chrono::steady_clock::now();
+    for (int c = 0; c < CLICKS; ++c) {
+        sf::Vector2f pos = randomWorldPos(clickRng, CLICK_WIDTH, CLICK_HEIGHT);
+        for (auto it = clickPointers.begin(); it != clickPointers.end(); ++it) {
+            if ((*it)->isClicked(pos)) {
+                clickPointers.erase(it);
+                ++scanRemoved;
+                break;
+            }
+        }
+    }
+    double scanUs = millisSince(start) * 1000.0 / CLICKS;
+
+    clickRng = Rng(8);
+    std::size_t gridRemoved = 0;
+    start = std::chrono::steady_clock::now();
+    for (int c = 0; c < CLICKS; ++c) {
+        gridRemoved += clickStore.removeAt(randomWorldPos(clickRng, CLICK_WIDTH, CLICK_HEIGHT));
+    }
+    double gridUs = millisSince(start) * 1000.0 / CLICKS;
+
+    std::cout << CLICKS << " clicks on " << NUM_SHAPES << " shapes in " << CLICK_WIDTH << "x" << CLICK_HEIGHT << "\n";
+    std::cout << "  scan + erase:              " << scanUs << " us/click, " << scanRemoved << " removed\n";
+    std::cout << "  grid + swap-and-pop:       " << gridUs << " us/click, " << gridRemoved << " removed\n";
+    return 0;
+}
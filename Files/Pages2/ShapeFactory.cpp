@@ -2,17 +2,20 @@
 #include "CircleShapeObj.hpp"
 #include "RectangleShapeObj.hpp"
 #include "TriangleShapeObj.hpp"
-#include <cstdlib>
+#include "Random.hpp"
+#include <type_traits>
 
 namespace {
     sf::Color randomColor() {
-        return sf::Color(rand() % 256, rand() % 256, rand() % 256);
+        Rng& rng = threadRng();
+        return sf::Color(rng.range(0, 255), rng.range(0, 255), rng.range(0, 255));
     }
 
     float randomSpeedComponent() {
         // 0.5-1.25, i.e. 1/4 of the original 2-5 speed range.
-        float speed = (2.f + (rand() % 4)) / 4.f;
-        return (rand() % 2 == 0) ? speed : -speed;
+        Rng& rng = threadRng();
+        float speed = (2.f + rng.range(0, 3)) / 4.f;
+        return (rng.range(0, 1) == 0) ? speed : -speed;
     }
 }
 
@@ -20,24 +23,47 @@ sf::Vector2f randomVelocity() {
     return sf::Vector2f(randomSpeedComponent(), randomSpeedComponent());
 }
 
-std::unique_ptr<Shape> createRandomShape(sf::Vector2f pos, sf::Vector2f velocity) {
-    int type = rand() % 3;
-    float size = 20.f + (rand() % 20); // 20-39
-    sf::Color color = randomColor();
+namespace {
+    // Picks a random type, size and color and hands the constructed
+    // shape to emit, so both factory functions make the same choices.
+    template <typename Emit>
+    void makeRandomShape(sf::Vector2f pos, sf::Vector2f velocity, Emit&& emit) {
+        Rng& rng = threadRng();
+        int type = rng.range(0, 2);
+        float size = 20.f + rng.range(0, 19); // 20-39
+        sf::Color color = randomColor();
 
-    std::unique_ptr<Shape> shape;
-    switch (type) {
-        case 0:
-            shape = std::make_unique<CircleShapeObj>(size, color, pos);
-            break;
-        case 1:
-            shape = std::make_unique<RectangleShapeObj>(sf::Vector2f(size * 2.f, size * 2.f), color, pos);
-            break;
-        default:
-            shape = std::make_unique<TriangleShapeObj>(size, color, pos);
-            break;
+        switch (type) {
+            case 0: {
+                CircleShapeObj shape(size, color, pos);
+                shape.setVelocity(velocity);
+                emit(shape);
+                break;
+            }
+            case 1: {
+                RectangleShapeObj shape(sf::Vector2f(size * 2.f, size * 2.f), color, pos);
+                shape.setVelocity(velocity);
+                emit(shape);
+                break;
+            }
+            default: {
+                TriangleShapeObj shape(size, color, pos);
+                shape.setVelocity(velocity);
+                emit(shape);
+                break;
+            }
+        }
     }
+}
 
-    shape->setVelocity(velocity);
+std::unique_ptr<Shape> createRandomShape(sf::Vector2f pos, sf::Vector2f velocity) {
+    std::unique_ptr<Shape> shape;
+    makeRandomShape(pos, velocity, [&](const auto& s) {
+        shape = std::make_unique<std::decay_t<decltype(s)>>(s);
+    });
     return shape;
 }
+
+void addRandomShape(ShapeStore& store, sf::Vector2f pos, sf::Vector2f velocity) {
+    makeRandomShape(pos, velocity, [&](const auto& s) { store.add(s); });
+}
@@ -0,0 +1,168 @@
+#include "ShapeStore.hpp"
+#include "Collision.hpp"
+
+template <typename T>
+void ShapeStore::addTo(Group<T>& g, const T& shape) {
+    g.shapes.push_back(shape);
+    g.bodies.push_back(shape.getBody());
+    g.slots.push_back(grid.insert(g.kind, static_cast<int>(g.bodies.size()) - 1, g.bodies.back()));
+}
+
+void ShapeStore::add(const CircleShapeObj& shape) {
+    addTo(circles, shape);
+}
+
+void ShapeStore::add(const RectangleShapeObj& shape) {
+    addTo(rectangles, shape);
+}
+
+void ShapeStore::add(const TriangleShapeObj& shape) {
+    addTo(triangles, shape);
+}
+
+template <typename T>
+void ShapeStore::removeFrom(Group<T>& g, int index) {
+    grid.remove(g.slots[index]);
+    int last = static_cast<int>(g.shapes.size()) - 1;
+    if (index != last) {
+        g.shapes[index] = g.shapes[last];
+        g.bodies[index] = g.bodies[last];
+        g.slots[index] = g.slots[last];
+        grid.reindex(g.slots[index], index);
+    }
+    g.shapes.pop_back();
+    g.bodies.pop_back();
+    g.slots.pop_back();
+}
+
+Body& ShapeStore::bodyAt(ColliderKind kind, int index) {
+    switch (kind) {
+        case ColliderKind::Circle: return circles.bodies[index];
+        case ColliderKind::Box: return rectangles.bodies[index];
+        default: return triangles.bodies[index];
+    }
+}
+
+void ShapeStore::refreshGrid() {
+    forEachGroup([&](auto& g) {
+        for (std::size_t i = 0; i < g.bodies.size(); ++i) {
+            grid.update(g.slots[i], g.bodies[i]);
+        }
+    });
+}
+
+void ShapeStore::reserve(std::size_t count) {
+    forEachGroup([&](auto& g) {
+        g.shapes.reserve(count);
+        g.bodies.reserve(count);
+        g.slots.reserve(count);
+    });
+    grid.reserve(3 * count);
+}
+
+std::size_t ShapeStore::size() const {
+    return circles.shapes.size() + rectangles.shapes.size() + triangles.shapes.size();
+}
+
+bool ShapeStore::empty() const {
+    return size() == 0;
+}
+
+void ShapeStore::fitWindow(unsigned windowWidth, unsigned windowHeight) {
+    grid.resize(windowWidth, windowHeight);
+}
+
+void ShapeStore::bounceAll(unsigned windowWidth, unsigned windowHeight) {
+    grid.resize(windowWidth, windowHeight);
+    forEachGroup([&](auto& g) {
+        ::bounceAll(g.bodies.data(), g.bodies.size(), windowWidth, windowHeight);
+    });
+    refreshGrid();
+}
+
+template <typename ForEachPair>
+std::size_t ShapeStore::resolvePairs(ForEachPair&& forEachPair, unsigned windowWidth, unsigned windowHeight) {
+    std::size_t contacts = 0;
+    forEachPair([&](ColliderKind kindA, int a, ColliderKind kindB, int b) {
+        Body& p = bodyAt(kindA, a);
+        Body& q = bodyAt(kindB, b);
+        Contact contact;
+        if (findContact(p, kindA, q, kindB, contact)) {
+            resolveContact(p, q, contact);
+            ++contacts;
+        }
+    });
+
+    // Being pushed out of a crowd can leave a body past the edge, where
+    // bounceAll would keep flipping it; put it back inside.
+    const float width = static_cast<float>(windowWidth);
+    const float height = static_cast<float>(windowHeight);
+    forEachGroup([&](auto& g) {
+        for (Body& b : g.bodies) {
+            b.topLeft.x = std::clamp(b.topLeft.x, 0.f, std::max(0.f, width - b.size.x));
+            b.topLeft.y = std::clamp(b.topLeft.y, 0.f, std::max(0.f, height - b.size.y));
+        }
+    });
+    refreshGrid();
+    return contacts;
+}
+
+std::size_t ShapeStore::collideAll(unsigned windowWidth, unsigned windowHeight) {
+    grid.resize(windowWidth, windowHeight);
+    return resolvePairs([&](auto&& test) {
+        grid.forEachPair([&](const SpatialGrid::Entry& a, const SpatialGrid::Entry& b) {
+            test(a.kind, a.index, b.kind, b.index);
+        });
+    }, windowWidth, windowHeight);
+}
+
+std::size_t ShapeStore::collideEveryPair(unsigned windowWidth, unsigned windowHeight) {
+    grid.resize(windowWidth, windowHeight);
+    return resolvePairs([&](auto&& test) {
+        const ColliderKind kinds[3] = { ColliderKind::Circle, ColliderKind::Box, ColliderKind::Triangle };
+        const int counts[3] = { static_cast<int>(circles.bodies.size()), static_cast<int>(rectangles.bodies.size()),
+                                static_cast<int>(triangles.bodies.size()) };
+        for (int ga = 0; ga < 3; ++ga) {
+            for (int a = 0; a < counts[ga]; ++a) {
+                for (int gb = ga; gb < 3; ++gb) {
+                    for (int b = (gb == ga) ? a + 1 : 0; b < counts[gb]; ++b) {
+                        test(kinds[ga], a, kinds[gb], b);
+                    }
+                }
+            }
+        }
+    }, windowWidth, windowHeight);
+}
+
+void ShapeStore::drawAll(sf::RenderWindow& window) {
+    forEachGroup([&](auto& g) {
+        for (std::size_t i = 0; i < g.shapes.size(); ++i) {
+            g.shapes[i].setBody(g.bodies[i]);
+            g.shapes[i].draw(window);
+        }
+    });
+}
+
+bool ShapeStore::removeAt(sf::Vector2f pos) {
+    // Shapes draw by kind, then by index, so the last one in that order
+    // is the one on top.
+    const SpatialGrid::Entry* hit = nullptr;
+    grid.forEachNear(pos, [&](const SpatialGrid::Entry& e) {
+        const Body& b = bodyAt(e.kind, e.index);
+        if (!sf::FloatRect(b.topLeft, b.size).contains(pos)) {
+            return;
+        }
+        if (!hit || e.kind > hit->kind || (e.kind == hit->kind && e.index > hit->index)) {
+            hit = &e;
+        }
+    });
+    if (!hit) {
+        return false;
+    }
+    switch (hit->kind) {
+        case ColliderKind::Circle: removeFrom(circles, hit->index); break;
+        case ColliderKind::Box: removeFrom(rectangles, hit->index); break;
+        default: removeFrom(triangles, hit->index); break;
+    }
+    return true;
+}
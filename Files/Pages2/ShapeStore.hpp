@@ -0,0 +1,83 @@
+#pragma once
+#include "CircleShapeObj.hpp"
+#include "RectangleShapeObj.hpp"
+#include "TriangleShapeObj.hpp"
+#include "SpatialGrid.hpp"
+#include <vector>
+
+// Holds a page's shapes by value, grouped by concrete type, instead of a
+// vector of unique_ptr<Shape>. Each group keeps the shapes themselves
+// (how they look) in one vector and their Bodies (where they are and how
+// they move) in a parallel one, so a frame's movement is one bounceAll
+// pass over packed floats per type. The SFML shapes are only brought up
+// to date with their bodies when they're drawn.
+//
+// A SpatialGrid tracks which shapes are near which, for collisions and
+// clicks. Removing a shape moves the last one of its type into its
+// place, so it's O(1) but changes the order within that type.
+//
+// Shapes are drawn type by type (circles, then rectangles, then
+// triangles), so overlapping shapes stack by type rather than by the
+// order they were added.
+class ShapeStore {
+private:
+    template <typename T>
+    struct Group {
+        std::vector<T> shapes;
+        std::vector<Body> bodies; // bodies[i] belongs to shapes[i]
+        std::vector<int> slots;   // shapes[i]'s entry in the grid
+        static constexpr ColliderKind kind = T::collider;
+    };
+    Group<CircleShapeObj> circles;
+    Group<RectangleShapeObj> rectangles;
+    Group<TriangleShapeObj> triangles;
+    SpatialGrid grid;
+
+    // Calls f on each group; the concrete classes are final, so inside
+    // f every call on a shape resolves at compile time.
+    template <typename F>
+    void forEachGroup(F&& f) {
+        f(circles);
+        f(rectangles);
+        f(triangles);
+    }
+
+    template <typename T>
+    void addTo(Group<T>& g, const T& shape);
+    template <typename T>
+    void removeFrom(Group<T>& g, int index);
+    Body& bodyAt(ColliderKind kind, int index);
+    // Tells the grid where every body is now.
+    void refreshGrid();
+    // Runs the exact test and response on every pair forEachPair hands
+    // out, then keeps the bodies inside the window.
+    template <typename ForEachPair>
+    std::size_t resolvePairs(ForEachPair&& forEachPair, unsigned windowWidth, unsigned windowHeight);
+
+public:
+    void add(const CircleShapeObj& shape);
+    void add(const RectangleShapeObj& shape);
+    void add(const TriangleShapeObj& shape);
+
+    // Room for count shapes of each type, so filling a page doesn't
+    // reallocate part way.
+    void reserve(std::size_t count);
+    std::size_t size() const;
+    bool empty() const;
+
+    // Sizes the grid to the window. bounceAll() and collideAll() do this
+    // too; calling it first just means clicks before then use a real grid.
+    void fitWindow(unsigned windowWidth, unsigned windowHeight);
+    void bounceAll(unsigned windowWidth, unsigned windowHeight);
+    // Pushes overlapping shapes apart and bounces them off each other.
+    // Returns the number of colliding pairs.
+    std::size_t collideAll(unsigned windowWidth, unsigned windowHeight);
+    // collideAll() without the grid: every pair gets the exact test.
+    // Only there to measure the grid against.
+    std::size_t collideEveryPair(unsigned windowWidth, unsigned windowHeight);
+    void drawAll(sf::RenderWindow& window);
+
+    // Removes the shape under pos, the topmost one if several overlap
+    // there. Returns false if there was none.
+    bool removeAt(sf::Vector2f pos);
+};
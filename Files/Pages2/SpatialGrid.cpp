@@ -0,0 +1,108 @@
+#include "SpatialGrid.hpp"
+
+SpatialGrid::SpatialGrid() : heads(1, -1) {}
+
+int SpatialGrid::columnOf(float x) const {
+    return std::clamp(static_cast<int>(x / cellSize), 0, columns - 1);
+}
+
+int SpatialGrid::rowOf(float y) const {
+    return std::clamp(static_cast<int>(y / cellSize), 0, rows - 1);
+}
+
+int SpatialGrid::cellOf(sf::Vector2f pos) const {
+    return rowOf(pos.y) * columns + columnOf(pos.x);
+}
+
+void SpatialGrid::link(int slot, int cell) {
+    Entry& e = entries[slot];
+    e.cell = cell;
+    e.prev = -1;
+    e.next = heads[cell];
+    if (e.next != -1) {
+        entries[e.next].prev = slot;
+    }
+    heads[cell] = slot;
+}
+
+void SpatialGrid::unlink(int slot) {
+    Entry& e = entries[slot];
+    if (e.prev != -1) {
+        entries[e.prev].next = e.next;
+    }
+    else {
+        heads[e.cell] = e.next;
+    }
+    if (e.next != -1) {
+        entries[e.next].prev = e.prev;
+    }
+}
+
+void SpatialGrid::relinkAll() {
+    if (width > 0 && height > 0) {
+        columns = static_cast<int>(width / cellSize) + 1;
+        rows = static_cast<int>(height / cellSize) + 1;
+    }
+    heads.assign(columns * rows, -1);
+    for (int s = 0; s < static_cast<int>(entries.size()); ++s) {
+        if (entries[s].cell != -1) {
+            link(s, cellOf(entries[s].topLeft));
+        }
+    }
+}
+
+int SpatialGrid::insert(ColliderKind kind, int index, const Body& body) {
+    int slot;
+    if (firstFree != -1) {
+        slot = firstFree;
+        firstFree = entries[slot].next;
+    }
+    else {
+        slot = static_cast<int>(entries.size());
+        entries.push_back(Entry{});
+    }
+    entries[slot] = Entry{ kind, index, body.topLeft, 0, -1, -1 };
+
+    float extent = std::max(body.size.x, body.size.y);
+    if (extent > cellSize) {
+        cellSize = extent;
+        relinkAll(); // links the new entry too
+    }
+    else {
+        link(slot, cellOf(body.topLeft));
+    }
+    return slot;
+}
+
+void SpatialGrid::remove(int slot) {
+    unlink(slot);
+    entries[slot].cell = -1; // not in any cell
+    entries[slot].next = firstFree;
+    firstFree = slot;
+}
+
+void SpatialGrid::reindex(int slot, int index) {
+    entries[slot].index = index;
+}
+
+void SpatialGrid::update(int slot, const Body& body) {
+    Entry& e = entries[slot];
+    e.topLeft = body.topLeft;
+    int cell = cellOf(body.topLeft);
+    if (cell != e.cell) {
+        unlink(slot);
+        link(slot, cell);
+    }
+}
+
+void SpatialGrid::resize(unsigned newWidth, unsigned newHeight) {
+    if (newWidth != width || newHeight != height) {
+        width = newWidth;
+        height = newHeight;
+        relinkAll();
+    }
+}
+
+void SpatialGrid::reserve(std::size_t count) {
+    entries.reserve(count);
+}
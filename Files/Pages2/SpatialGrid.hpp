@@ -0,0 +1,101 @@
+#pragma once
+#include "Shape.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Index of where the shapes are, so finding the shapes under a point or
+// next to each other only looks at a few of them. Each body sits in the
+// one cell holding its top-left corner, and cells are at least as big as
+// the largest body, so anything a body can touch is in its own cell or
+// one of the eight around it.
+//
+// The cells are linked lists threaded through the entries, and a shape
+// is only relinked when it crosses a cell edge, which for a shape moving
+// a pixel a frame is rarely. Nothing allocates except insert() and
+// resize().
+//
+// Entries name their shape the way ShapeStore does, by kind and index;
+// ShapeStore calls reindex() when a shape moves to a new index.
+class SpatialGrid {
+public:
+    struct Entry {
+        ColliderKind kind;
+        int index;
+        sf::Vector2f topLeft; // as of the last insert()/update()
+        int cell;
+        int prev;
+        int next;  // next in the same cell, or in the free list
+    };
+
+    SpatialGrid();
+
+    // Adds a body and returns the slot that refers to it from now on.
+    int insert(ColliderKind kind, int index, const Body& body);
+    void remove(int slot);
+    // The shape in slot now lives at index.
+    void reindex(int slot, int index);
+    // Records where the body in slot is now.
+    void update(int slot, const Body& body);
+
+    // Sizes the cells to cover a width x height window; relinks every
+    // entry, but only when the size actually changed.
+    void resize(unsigned width, unsigned height);
+    void reserve(std::size_t count);
+
+    // Calls f(entry) for every entry whose body could contain pos.
+    template <typename F>
+    void forEachNear(sf::Vector2f pos, F&& f) const {
+        int x = columnOf(pos.x), y = rowOf(pos.y);
+        for (int cy = std::max(y - 1, 0); cy <= y; ++cy) {
+            for (int cx = std::max(x - 1, 0); cx <= x; ++cx) {
+                for (int s = heads[cy * columns + cx]; s != -1; s = entries[s].next) {
+                    f(entries[s]);
+                }
+            }
+        }
+    }
+
+    // Calls f(a, b) once for every pair of entries whose bodies could
+    // overlap: within a cell, then against the four neighbours that come
+    // after it (right, and the three below).
+    template <typename F>
+    void forEachPair(F&& f) const {
+        static const int forward[4][2] = { { 1, 0 }, { -1, 1 }, { 0, 1 }, { 1, 1 } };
+        for (int y = 0; y < rows; ++y) {
+            for (int x = 0; x < columns; ++x) {
+                for (int a = heads[y * columns + x]; a != -1; a = entries[a].next) {
+                    for (int b = entries[a].next; b != -1; b = entries[b].next) {
+                        f(entries[a], entries[b]);
+                    }
+                    for (const auto& step : forward) {
+                        int nx = x + step[0], ny = y + step[1];
+                        if (nx < 0 || nx >= columns || ny >= rows) {
+                            continue;
+                        }
+                        for (int b = heads[ny * columns + nx]; b != -1; b = entries[b].next) {
+                            f(entries[a], entries[b]);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+private:
+    std::vector<Entry> entries; // by slot
+    std::vector<int> heads;     // first slot in each cell, or -1
+    int firstFree = -1;
+    int columns = 1, rows = 1;
+    float cellSize = 1.f;
+    unsigned width = 0, height = 0;
+
+    // Bodies a little outside the window count as in the edge cells,
+    // which keeps neighbours neighbours.
+    int columnOf(float x) const;
+    int rowOf(float y) const;
+    int cellOf(sf::Vector2f pos) const;
+    void link(int slot, int cell);
+    void unlink(int slot);
+    void relinkAll();
+};
@@ -4,6 +4,7 @@ TriangleShapeObj::TriangleShapeObj(float radius, sf::Color color, sf::Vector2f p
     : triangle(radius, 3) {
     triangle.setFillColor(color);
     triangle.setPosition(pos);
+    localBounds = triangle.getLocalBounds();
 }
 
 void TriangleShapeObj::draw(sf::RenderWindow& window) const {
@@ -17,7 +18,3 @@ void TriangleShapeObj::setPosition(sf::Vector2f pos) {
 sf::Vector2f TriangleShapeObj::getPosition() const {
     return triangle.getPosition();
 }
-
-sf::FloatRect TriangleShapeObj::getBounds() const {
-    return triangle.getGlobalBounds();
-}
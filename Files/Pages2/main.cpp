@@ -1,9 +1,51 @@
 #include "AppManager.hpp"
-#include <cstdlib>
+#include "AllocCounter.hpp"
+#include "Page1.hpp"
+#include "Page2.hpp"
+#include "Random.hpp"
 #include <ctime>
+#include <iostream>
+#include <memory>
+#include <string>
 
-int main() {
-    srand(static_cast<unsigned>(time(nullptr)));
+namespace {
+    // Steps both pages the way run() does, but without a window: only
+    // update() runs, since drawing and events need one. Returns how many
+    // frames after the first warmupFrames allocated on the heap.
+    long countAllocatingFrames(long frames, long warmupFrames) {
+        const sf::Vector2u size(800, 600);
+        std::unique_ptr<Page> pages[] = { std::make_unique<Page1>(), std::make_unique<Page2>() };
+        long allocatingFrames = 0, strayAllocations = 0;
+        for (long f = 0; f < frames; ++f) {
+            long before = threadAllocationCount();
+            for (auto& page : pages) {
+                page->update(size);
+            }
+            long allocs = threadAllocationCount() - before;
+            if (f >= warmupFrames && allocs > 0) {
+                allocatingFrames++;
+                strayAllocations += allocs;
+            }
+        }
+        std::cout << "frames: " << frames << ", warm frames that allocated: " << allocatingFrames
+                  << " (" << strayAllocations << " allocations)" << std::endl;
+        return allocatingFrames;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    seedRandom(static_cast<uint64_t>(time(nullptr)));
+
+    // --alloc-check: step both pages 600 frames headless and fail if any
+    // warm frame allocated, or if nothing could be counted.
+    if (argc > 1 && std::string(argv[1]) == "--alloc-check") {
+        long allocatingFrames = countAllocatingFrames(600, 60);
+#if !COUNT_ALLOCS
+        std::cout << "COUNT_ALLOCS is 0, nothing was counted" << std::endl;
+        return 1;
+#endif
+        return allocatingFrames == 0 ? 0 : 1;
+    }
     AppManager::getInstance().run();
     return 0;
 }
@@ -0,0 +1,47 @@
+#include "allocs.hpp"
+#include "config.hpp"
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+
+static std::atomic<long> allocations(0), frees(0);
+
+long Allocations(){
+	return allocations.load(std::memory_order_relaxed);
+}
+
+long Frees(){
+	return frees.load(std::memory_order_relaxed);
+}
+
+#if COUNT_ALLOCS
+static void * Allocate(std::size_t size){
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	void *p = malloc(size ? size : 1);
+	if(!p)
+		throw std::bad_alloc();
+	return p;
+}
+
+static void Release(void *p){
+	if(!p)
+		return;
+	frees.fetch_add(1, std::memory_order_relaxed);
+	free(p);
+}
+
+void * operator new(std::size_t size){ return Allocate(size); }
+void * operator new[](std::size_t size){ return Allocate(size); }
+void * operator new(std::size_t size, const std::nothrow_t &) noexcept{
+	try{ return Allocate(size); }catch(...){ return NULL; }
+}
+void * operator new[](std::size_t size, const std::nothrow_t &) noexcept{
+	try{ return Allocate(size); }catch(...){ return NULL; }
+}
+void operator delete(void *p) noexcept{ Release(p); }
+void operator delete[](void *p) noexcept{ Release(p); }
+void operator delete(void *p, std::size_t) noexcept{ Release(p); }
+void operator delete[](void *p, std::size_t) noexcept{ Release(p); }
+void operator delete(void *p, const std::nothrow_t &) noexcept{ Release(p); }
+void operator delete[](void *p, const std::nothrow_t &) noexcept{ Release(p); }
+#endif
@@ -0,0 +1,11 @@
+#ifndef ALLOCS_HPP
+#define ALLOCS_HPP
+
+//With COUNT_ALLOCS set, allocs.cpp replaces the global operator new and
+//delete with versions that count every call, so a run can check that
+//warmed-up ticks and frames never touch the heap. Reading the counters
+//is cheap enough to do around every phase.
+long Allocations();
+long Frees();
+
+#endif
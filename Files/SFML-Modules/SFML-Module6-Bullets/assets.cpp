@@ -0,0 +1,45 @@
+#include "assets.hpp"
+
+std::mutex Assets::lock;
+std::map<std::string, std::shared_ptr<sf::Texture>> Assets::textures;
+std::map<std::string, std::shared_ptr<sf::Font>> Assets::fonts;
+int Assets::loads = 0;
+
+std::shared_ptr<sf::Texture> Assets::GetTexture(const std::string &path){
+	std::lock_guard<std::mutex> l(lock);
+	auto it = textures.find(path);
+	if(it!=textures.end())
+		return it->second;
+	std::shared_ptr<sf::Texture> t(new sf::Texture());
+	loads++;
+	if(!t->loadFromFile(path))
+		t.reset();
+	textures[path] = t;
+	return t;
+}
+
+std::shared_ptr<sf::Font> Assets::GetFont(const std::string &path){
+	std::lock_guard<std::mutex> l(lock);
+	auto it = fonts.find(path);
+	if(it!=fonts.end())
+		return it->second;
+	std::shared_ptr<sf::Font> f(new sf::Font());
+	loads++;
+	if(!f->loadFromFile(path))
+		f.reset();
+	fonts[path] = f;
+	return f;
+}
+
+void Assets::Trim(){
+	std::lock_guard<std::mutex> l(lock);
+	for(auto it = textures.begin(); it!=textures.end();)
+		it = (it->second.use_count()==1) ? textures.erase(it) : ++it;
+	for(auto it = fonts.begin(); it!=fonts.end();)
+		it = (it->second.use_count()==1) ? fonts.erase(it) : ++it;
+}
+
+int Assets::Loads(){
+	std::lock_guard<std::mutex> l(lock);
+	return loads;
+}
@@ -0,0 +1,31 @@
+#ifndef ASSETS_HPP
+#define ASSETS_HPP
+
+#include <SFML/Graphics.hpp>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+//Process-wide cache of textures and fonts, keyed by path.
+//The first Get for a path reads the file; every later one hands out the
+//same object, so building a scene does no disk I/O once the assets it
+//uses have been loaded. The cache keeps its own reference, so assets
+//survive scenes coming and going until Trim() drops the unused ones.
+//A path that fails to load is remembered as NULL and not retried.
+class Assets{
+	private:
+		static std::mutex lock;
+		static std::map<std::string, std::shared_ptr<sf::Texture>> textures;
+		static std::map<std::string, std::shared_ptr<sf::Font>> fonts;
+		static int loads;
+	public:
+		static std::shared_ptr<sf::Texture> GetTexture(const std::string &path);
+		static std::shared_ptr<sf::Font> GetFont(const std::string &path);
+		//free every asset nobody outside the cache is holding
+		static void Trim();
+		//files read from disk so far
+		static int Loads();
+};
+
+#endif
@@ -0,0 +1,38 @@
+#include "batch.hpp"
+
+Batch::Batch() : verts(sf::Quads){
+	used = 0;
+}
+
+void Batch::Clear(){
+	used = 0;
+}
+
+void Batch::Add(const EntityList &list, float lag, const sf::RectangleShape &shape){
+	std::size_t need = used + 4*list.count;
+	if(verts.getVertexCount()<need)
+		verts.resize(need);
+
+	//the quad corners relative to an entity's position
+	sf::Vector2f topLeft = -shape.getOrigin();
+	sf::Vector2f bottomRight = topLeft + shape.getSize();
+	sf::Color color = shape.getFillColor();
+	for(int i = 0; i<list.count; i++){
+		sf::Vector2f pos(list.x[i] - list.vx[i]*lag, list.y[i]);
+		sf::Vertex *q = &verts[used];
+		q[0] = sf::Vertex(pos + topLeft, color);
+		q[1] = sf::Vertex(pos + sf::Vector2f(bottomRight.x, topLeft.y), color);
+		q[2] = sf::Vertex(pos + bottomRight, color);
+		q[3] = sf::Vertex(pos + sf::Vector2f(topLeft.x, bottomRight.y), color);
+		used += 4;
+	}
+}
+
+void Batch::Draw(sf::RenderWindow &window){
+	if(used>0)
+		window.draw(&verts[0], used, sf::Quads);
+}
+
+std::size_t Batch::QuadCount(){
+	return used/4;
+}
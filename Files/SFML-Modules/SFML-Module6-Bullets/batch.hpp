@@ -0,0 +1,26 @@
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include <SFML/Graphics.hpp>
+#include "snapshot.hpp"
+
+//Collects one quad per entity into a single vertex array so a whole
+//frame's enemies and bullets go to the GPU in one draw call instead of
+//one window.draw() per entity. The array only ever grows, so after the
+//first big wave building a frame doesn't allocate.
+class Batch{
+	private:
+		sf::VertexArray verts;
+		std::size_t used;
+	public:
+		Batch();
+		void Clear();
+		//add a quad for every entity in list, drawn lag ticks behind
+		//its snapshot position and sized, centred and coloured like
+		//shape
+		void Add(const EntityList &list, float lag, const sf::RectangleShape &shape);
+		void Draw(sf::RenderWindow &window);
+		std::size_t QuadCount();
+};
+
+#endif
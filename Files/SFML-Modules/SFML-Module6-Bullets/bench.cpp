@@ -0,0 +1,221 @@
+#include <SFML/Graphics.hpp>
+#include "config.hpp"
+#include "bullet.hpp"
+#include "entitystore.hpp"
+#include "grid.hpp"
+#include "integrate.hpp"
+#include "rng.hpp"
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+
+static double Seconds(std::chrono::steady_clock::time_point start){
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+//Collision scaling: N enemies and N bullets scattered over the window,
+//tested the old way (every bullet against every enemy) and through the
+//Grid broad-phase.
+static void BenchGrid(int n){
+	EntityStore enemies(n, PoolReject);
+	std::vector<sf::Vector2f> bullets(n);
+	for(int i = 0; i<n; i++){
+		enemies.Spawn(rand()%WSIZE, rand()%WSIZE, ENEMY_SPEED);
+		bullets[i] = sf::Vector2f(rand()%WSIZE, rand()%WSIZE);
+	}
+
+	std::cout<<"collision, entities: "<<n<<std::endl;
+
+	//brute force is O(n^2); past 10k it would take minutes
+	if(n<=10000){
+		auto start = std::chrono::steady_clock::now();
+		long hits = 0;
+		for(int b = 0; b<n; b++)
+			for(int e = 0; e<n; e++)
+				if(Bullet::Hits(bullets[b], sf::Vector2f(enemies.x[e], enemies.y[e])))
+					hits++;
+		std::cout<<"  brute force: "<<Seconds(start)*1000<<" ms, "<<hits<<" hits"<<std::endl;
+	}else{
+		std::cout<<"  brute force: skipped"<<std::endl;
+	}
+
+	Grid grid;
+	auto start = std::chrono::steady_clock::now();
+	grid.Build(enemies);
+	double build = Seconds(start);
+	long hits = 0;
+	for(int b = 0; b<n; b++)
+		grid.Query(bullets[b].x, bullets[b].y, [&](int e){
+			if(Bullet::Hits(bullets[b], sf::Vector2f(enemies.x[e], enemies.y[e])))
+				hits++;
+		});
+	std::cout<<"  grid: "<<Seconds(start)*1000<<" ms ("<<build*1000<<" ms build), "<<hits<<" hits"<<std::endl;
+}
+
+//The enemy layout before EntityStore: a whole RectangleShape per enemy
+//just to hold its position.
+struct AoSEnemy{
+	int health = 100;
+	bool isActive = false;
+	sf::RectangleShape body;
+};
+
+//Per-tick move-and-cull cost of the old array of objects against the
+//structure of arrays. Entities respawn at the right edge when culled so
+//the live count stays at n for every tick.
+static void BenchLayout(int n){
+	const int ticks = 100;
+	std::cout<<"move, entities: "<<n<<std::endl;
+
+	std::vector<AoSEnemy> aos(n);
+	for(int i = 0; i<n; i++){
+		aos[i].body.setPosition(rand()%WSIZE, rand()%WSIZE);
+		aos[i].isActive = true;
+	}
+	auto start = std::chrono::steady_clock::now();
+	for(int t = 0; t<ticks; t++){
+		for(int i = 0; i<n; i++){
+			if(aos[i].isActive){
+				aos[i].body.move(ENEMY_SPEED, 0);
+				if(aos[i].body.getPosition().x<=CULL_MIN)
+					aos[i].body.setPosition(WSIZE + 10, aos[i].body.getPosition().y);
+			}
+		}
+	}
+	std::cout<<"  AoS: "<<Seconds(start)*1e6/ticks<<" us/tick ("<<sizeof(AoSEnemy)<<" bytes/enemy)"<<std::endl;
+
+	EntityStore soa(n, PoolReject);
+	for(int i = 0; i<n; i++)
+		soa.Spawn(rand()%WSIZE, rand()%WSIZE, ENEMY_SPEED);
+	start = std::chrono::steady_clock::now();
+	for(int t = 0; t<ticks; t++){
+		soa.Integrate(CULL_MIN, CULL_MAX);
+		while(soa.ActiveCount()<n)
+			soa.Spawn(WSIZE + 10, t, ENEMY_SPEED);
+	}
+	std::cout<<"  SoA: "<<Seconds(start)*1e6/ticks<<" us/tick"<<std::endl;
+}
+
+//Raw integrate-and-cull kernel throughput for every ISA this build and
+//CPU can run. Each kernel gets the same starting positions; the masks
+//from the first tick are checked against the scalar one.
+static void BenchKernels(int n){
+	const int ticks = 200;
+	struct Kernel{ const char *name; IntegrateKernel fn; };
+	std::vector<Kernel> kernels;
+	kernels.push_back({"scalar", IntegrateScalar});
+#if defined(__x86_64__) || defined(__i386__)
+	kernels.push_back({"sse2", IntegrateSSE2});
+	if(__builtin_cpu_supports("avx2"))
+		kernels.push_back({"avx2", IntegrateAVX2});
+#endif
+
+	std::vector<float> start(n), vx(n);
+	for(int i = 0; i<n; i++){
+		start[i] = rand()%WSIZE;
+		vx[i] = (i%2) ? ENEMY_SPEED : BULLET_SPEED;
+	}
+	std::vector<uint64_t> reference((n+63)/64), cull((n+63)/64);
+
+	std::cout<<"integrate, entities: "<<n<<" (build uses "<<IntegrateISA()<<")"<<std::endl;
+	for(Kernel &k : kernels){
+		std::vector<float> x = start;
+		k.fn(x.data(), vx.data(), n, CULL_MIN, CULL_MAX, cull.data());
+		if(k.fn==IntegrateScalar)
+			reference = cull;
+		bool same = (cull==reference);
+
+		auto begin = std::chrono::steady_clock::now();
+		for(int t = 1; t<ticks; t++)
+			k.fn(x.data(), vx.data(), n, CULL_MIN, CULL_MAX, cull.data());
+		double ns = Seconds(begin)*1e9;
+		std::cout<<"  "<<k.name<<": "<<(double)n*(ticks-1)/ns<<" entities/ns"
+			<<(same ? "" : "  MASK MISMATCH")<<std::endl;
+	}
+}
+
+//Spawn-style draws (a y between 100 and 800) from rand() against Rng,
+//one at a time and through the bulk Fill.
+static void BenchRng(int n){
+	std::vector<int> out(n);
+	std::cout<<"random ints, draws: "<<n<<std::endl;
+
+	auto start = std::chrono::steady_clock::now();
+	for(int i = 0; i<n; i++)
+		out[i] = rand()%701 + 100;
+	std::cout<<"  rand(): "<<n/Seconds(start)/1e6<<" M/s"<<std::endl;
+
+	Rng rng(1);
+	start = std::chrono::steady_clock::now();
+	for(int i = 0; i<n; i++)
+		out[i] = rng.Range(100, 800);
+	std::cout<<"  Rng::Range: "<<n/Seconds(start)/1e6<<" M/s"<<std::endl;
+
+	start = std::chrono::steady_clock::now();
+	rng.Fill(out.data(), n, 100, 800);
+	std::cout<<"  Rng::Fill: "<<n/Seconds(start)/1e6<<" M/s"<<std::endl;
+
+	long sum = 0;
+	for(int v : out)
+		sum += v;
+	std::cout<<"  mean: "<<(double)sum/n<<std::endl;
+}
+
+//Tunnelling check rather than a timing: fire one bullet at one enemy
+//from random offsets with both speeds scaled up (as if the tick rate
+//were cut by the same factor) and compare the end-of-tick Hits test and
+//the swept test against 64 sub-steps per tick. Returns how many real
+//hits the swept test missed, which should be none.
+static long BenchSweep(int pairs){
+	Rng rng(7);
+	std::cout<<"tunnelling, pairs: "<<pairs<<std::endl;
+	long missed = 0;
+	for(int scale = 1; scale<=8; scale *= 2){
+		float bv = BULLET_SPEED*scale, ev = ENEMY_SPEED*scale;
+		long real = 0, tickMiss = 0, sweepMiss = 0, sweepExtra = 0;
+		for(int p = 0; p<pairs; p++){
+			sf::Vector2f b(0, 0), e(100 + rng.Float()*bv, (rng.Float() - 0.5f)*PSIZE*2);
+			bool truth = false, ticked = false, swept = false;
+			while(b.x<e.x + PSIZE*2){
+				for(int s = 1; s<=64; s++){
+					float f = s/64.0f - 1;
+					if(Bullet::Hits(b + sf::Vector2f(bv*(1 + f), 0), e + sf::Vector2f(ev*(1 + f), 0)))
+						truth = true;
+				}
+				b.x += bv;
+				e.x += ev;
+				ticked |= Bullet::Hits(b, e);
+				swept |= Bullet::Sweeps(b, sf::Vector2f(bv, 0), e, sf::Vector2f(ev, 0));
+			}
+			real += truth;
+			tickMiss += truth && !ticked;
+			sweepMiss += truth && !swept;
+			sweepExtra += swept && !truth;
+		}
+		std::cout<<"  speed x"<<scale<<": "<<real<<" real hits, end-of-tick missed "<<tickMiss
+			<<", swept missed "<<sweepMiss<<" (+"<<sweepExtra<<" grazes finer than a sub-step)"<<std::endl;
+		missed += sweepMiss;
+	}
+	return missed;
+}
+
+//./benchapp --sweep-check runs only the tunnelling check. Either way
+//the exit code is 1 if the swept test missed a hit.
+int main(int argc, char *argv[]){
+	const int sizes[] = {1000, 10000, 100000};
+	srand(1);
+	if(argc>1 && strcmp(argv[1], "--sweep-check")==0)
+		return BenchSweep(100000)>0 ? 1 : 0;
+
+	for(int n : sizes)
+		BenchGrid(n);
+	for(int n : sizes)
+		if(n>=10000)
+			BenchLayout(n);
+	for(int n : sizes)
+		BenchKernels(n);
+	BenchRng(10000000);
+	return BenchSweep(100000)>0 ? 1 : 0;
+}
@@ -1,27 +1,72 @@
-
 #include <SFML/Graphics.hpp>
+#include <cmath>
 #include "config.hpp"
 #include "bg.hpp"
 BG::BG(){
-    	texture1.loadFromFile("images/bg.jpg");
-    	sprite1.setTexture(texture1);
-	sprite2.setTexture(texture1);
+#if BG_QUAD
+	addLayer("images/bg.jpg", 3);
+#else
+	texture1 = Assets::GetTexture("images/bg.jpg");
+	if(texture1){
+		sprite1.setTexture(*texture1);
+		sprite2.setTexture(*texture1);
+	}
 	sprite1.scale(2,2);
 	sprite2.scale(2,2);
 	sprite2.setPosition(WSIZE,0);
+#endif
+}
+
+void BG::addLayer(const std::string & path, float speed, float scale){
+	Layer l;
+	l.texture = Assets::GetTexture(path);
+	if(!l.texture)
+		return;
+	l.texture->setRepeated(true);
+	l.speed = speed;
+	l.scale = scale;
+	l.offset = 0;
+	l.quad = sf::VertexArray(sf::Quads, 4);
+	l.quad[0].position = sf::Vector2f(0, 0);
+	l.quad[1].position = sf::Vector2f(WSIZE, 0);
+	l.quad[2].position = sf::Vector2f(WSIZE, WSIZE);
+	l.quad[3].position = sf::Vector2f(0, WSIZE);
+	layers.push_back(l);
+	move(0);
 }
 
 void BG::draw(sf::RenderWindow & window){
+#if BG_QUAD
+	for(Layer &l : layers)
+		window.draw(l.quad, l.texture.get());
+#else
 	window.draw(sprite1);
 	window.draw(sprite2);
+#endif
 }
-void BG::move(){
-	sprite1.move(-3,0);
-	sprite2.move(-3,0);
+void BG::move(float dt){
+#if BG_QUAD
+	for(Layer &l : layers){
+		//offset is in texture pixels; keep it inside one image width
+		//so the coordinates never get big enough to lose precision
+		float w = l.texture->getSize().x;
+		l.offset = std::fmod(l.offset + l.speed*TICKRATE*dt/l.scale, w);
+		float left = l.offset, right = l.offset + WSIZE/l.scale;
+		float bottom = WSIZE/l.scale;
+		l.quad[0].texCoords = sf::Vector2f(left, 0);
+		l.quad[1].texCoords = sf::Vector2f(right, 0);
+		l.quad[2].texCoords = sf::Vector2f(right, bottom);
+		l.quad[3].texCoords = sf::Vector2f(left, bottom);
+	}
+#else
+	//3 px per tick, whatever the frame rate
+	sprite1.move(-3*TICKRATE*dt,0);
+	sprite2.move(-3*TICKRATE*dt,0);
 
 	if(sprite1.getPosition().x<=-WSIZE)
 		sprite1.setPosition(WSIZE,0);
 	if(sprite2.getPosition().x<=-WSIZE)
 		sprite2.setPosition(WSIZE,0);
+#endif
 
 }
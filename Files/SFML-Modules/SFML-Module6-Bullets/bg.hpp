@@ -1,16 +1,33 @@
-
 #include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <vector>
 #include "config.hpp"
+#include "assets.hpp"
 
 class BG{
 	private:
-		sf::Texture texture1;
+		//one repeating texture on one window-sized quad; scrolling
+		//only moves the texture coordinates
+		struct Layer{
+			std::shared_ptr<sf::Texture> texture;
+			sf::VertexArray quad;
+			float speed, scale, offset;
+		};
+		std::vector<Layer> layers;
+
+		//shared through Assets, so every BG reuses the one upload
+		std::shared_ptr<sf::Texture> texture1;
 		sf::Sprite sprite1, sprite2;
 		
 	
 	public:
 		BG();
-		void move();
+		//stack another layer on top (BG_QUAD only), scrolling left at
+		//speed px per tick and drawn scale times its image size; use
+		//smaller speeds for layers further back
+		void addLayer(const std::string & path, float speed, float scale=2);
+		//scroll by dt seconds worth of motion
+		void move(float dt);
                 void draw(sf::RenderWindow & window);
 };
-
@@ -1,40 +1,51 @@
-
 #include "bullet.hpp"
-#include<iostream>
+
 Bullet::Bullet(){
 	body.setSize(sf::Vector2f(PSIZE/2, PSIZE/3));
 	body.setOrigin(PSIZE/4,PSIZE/6);
    	body.setPosition(-100,-100 );
     	body.setFillColor(sf::Color::White);
-	isActive = false;
 }
 
-void Bullet::Move(){
-	if(isActive){
-		body.move(9,0);
-		if(body.getPosition().x>=WSIZE+50)
-			isActive = false;
-	}	
-
-}
-void Bullet::Draw(sf::RenderWindow &window){
-	if(isActive)
-		window.draw(body);
+void Bullet::Draw(sf::RenderWindow &window, float x, float y){
+	body.setPosition(x, y);
+	window.draw(body);
 	return;
 }
-void Bullet::CheckCollision(Pool &pool){
-	if(isActive){
-		//loop throught the enemy pool
-		for(int i = 0; i<20; i++){
-			if((pool.GetPool())[i].isActive){
-				if(body.getGlobalBounds().intersects((pool.GetPool())[i].body.getGlobalBounds()))
-				{
-				(pool.GetPool())[i].isActive=false;
-				isActive = false;	
-				}
-			}	
+bool Bullet::Hits(sf::Vector2f b, sf::Vector2f e){
+	//neither shape rotates, so the boxes are just centre +/- half size
+	float dx = b.x - e.x, dy = b.y - e.y;
+	return dx < PSIZE/2.0f + PSIZE/4.0f && -dx < PSIZE/2.0f + PSIZE/4.0f
+		&& dy < PSIZE/2.0f + PSIZE/6.0f && -dy < PSIZE/2.0f + PSIZE/6.0f;
+}
+bool Bullet::Sweeps(sf::Vector2f b, sf::Vector2f bv, sf::Vector2f e, sf::Vector2f ev){
+	//work in the enemy's frame: the bullet's centre runs along the
+	//segment from end - v to end, and hits if that segment enters the
+	//enemy box grown by the bullet's half size (slab test)
+	sf::Vector2f end = b - e, v = bv - ev;
+	sf::Vector2f half(PSIZE/2.0f + PSIZE/4.0f, PSIZE/2.0f + PSIZE/6.0f);
+	float enter = 0, leave = 1;
+	for(int axis = 0; axis<2; axis++){
+		float p = axis ? end.y : end.x, d = axis ? v.y : v.x, h = axis ? half.y : half.x;
+		//position along this axis at time t (0..1) is p - d*(1-t)
+		float start = p - d;
+		if(d==0){
+			if(start>=h || start<=-h)
+				return false;
+			continue;
 		}
-	}	
-
+		float t0 = (-h - start)/d, t1 = (h - start)/d;
+		if(t0>t1){
+			float t = t0;
+			t0 = t1;
+			t1 = t;
+		}
+		if(t0>enter)
+			enter = t0;
+		if(t1<leave)
+			leave = t1;
+		if(enter>=leave)
+			return false;
+	}
+	return true;
 }
-
@@ -1,16 +1,24 @@
+#ifndef BULLET_HPP
+#define BULLET_HPP
+
 #include <SFML/Graphics.hpp>
 #include "config.hpp"
-#include "pool.hpp"
+//Bullet positions live in the Player's EntityStore; this is just the
+//shape used to draw each one.
 class Bullet{
 	private:
 
 	public:
-    		bool isActive;
 		sf::RectangleShape body;
     		
 		Bullet();
-		void Move();
-		void Draw(sf::RenderWindow &window);
-		void CheckCollision(Pool & pool);
+		void Draw(sf::RenderWindow &window, float x, float y);
+		//true if a bullet centred at b overlaps an enemy centred at e
+		static bool Hits(sf::Vector2f b, sf::Vector2f e);
+		//true if they overlapped at any point during the tick that just
+		//moved the bullet by bv to b and the enemy by ev to e, so fast
+		//bullets can't jump clean over an enemy between two ticks
+		static bool Sweeps(sf::Vector2f b, sf::Vector2f bv, sf::Vector2f e, sf::Vector2f ev);
 };
 
+#endif
@@ -8,15 +8,13 @@ Button::Button(int w, int h, int x, int y, sf::Color c){
     	button.setFillColor(c); 
 }
 	
-void Button::CheckEvent(sf::RenderWindow & window){
-	sf::Vector2i mpos;
-	if (sf::Mouse::isButtonPressed(sf::Mouse::Left))
+void Button::OnInput(const InputEvent & e, sf::RenderWindow & window){
+	if (e.type==MouseDown && e.button==sf::Mouse::Left)
 	{
-    	   	// left click...i
-		//check the position of the mouse
-		mpos = sf::Mouse::getPosition(window);
+    	   	// left click...
+		//the event carries where the mouse was
 		// if over button,  do something
-		if(button.getGlobalBounds().contains(mpos.x, mpos.y)){
+		if(button.getGlobalBounds().contains(e.mouse.x, e.mouse.y)){
 			WasClicked(window);
 		}	
 	}
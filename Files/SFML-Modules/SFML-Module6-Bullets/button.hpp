@@ -1,5 +1,6 @@
 
 #include <SFML/Graphics.hpp>
+#include "input.hpp"
 
 class Button{
 	private:
@@ -7,7 +8,8 @@ class Button{
 	public:
 		sf::RectangleShape button;		
 		Button(int, int, int, int, sf::Color);
-		void CheckEvent(sf::RenderWindow &window);
+		//subscribed to Input; a left click on the button clicks it
+		void OnInput(const InputEvent &e, sf::RenderWindow &window);
 		void WasClicked(sf::RenderWindow &window);	
 
 };
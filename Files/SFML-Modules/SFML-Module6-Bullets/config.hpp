@@ -1,3 +1,49 @@
+#ifndef CONFIG_HPP
+#define CONFIG_HPP
+
 #define WSIZE 900
 #define PSIZE 24
 #define movespeed 5
+
+//starting pool sizes; the enemy pool grows by this much when a wave
+//needs more, the bullet pool turns extra shots away instead
+#define ENEMY_POOL 20
+#define BULLET_POOL 20
+
+//pixels per tick, and the strip outside of which entities are culled
+#define ENEMY_SPEED -4
+#define BULLET_SPEED 9
+#define CULL_MIN -50
+#define CULL_MAX (WSIZE+50)
+
+//1 draws all enemies and bullets with one batched draw call,
+//0 falls back to one window.draw() per entity
+#define BATCH_DRAW 1
+
+//1 draws the background as one quad per layer with a repeating
+//texture, 0 falls back to the two leapfrogging sprites
+#define BG_QUAD 1
+
+//threads for the update jobs (-1 = one per core) and slots per job;
+//JOB_CHUNK must be a multiple of 64
+#define WORKERS -1
+#define JOB_CHUNK 4096
+
+//1 times every phase of the tick and frame (F3 toggles the overlay,
+//the numbers go to PROFILE_CSV on exit); 0 compiles the timers out
+#define PROFILE 1
+#define PROFILE_CSV "profile.csv"
+
+//1 counts every operator new/delete (see allocs.hpp) so --alloc-check
+//can prove warm ticks don't allocate; 0 leaves the allocator alone
+#define COUNT_ALLOCS 1
+
+//simulation runs at a fixed rate, one update per tick
+#define TICKRATE 60
+#define DT (1.0f/TICKRATE)
+
+//ticks between enemy spawns, and between shots
+#define SPAWN_TICKS TICKRATE
+#define RELOAD_TICKS (TICKRATE/4)
+
+#endif
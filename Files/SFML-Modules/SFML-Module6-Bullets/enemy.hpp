@@ -1,15 +1,20 @@
+#ifndef ENEMY_HPP
+#define ENEMY_HPP
+
 #include <SFML/Graphics.hpp>
 #include "config.hpp"
+//Enemy positions live in the Pool's EntityStore; this is just the
+//shape used to draw each one.
 class Enemy{
 	private:
-		int health = 100;
+
 	public:
-    		bool isActive;
 		sf::RectangleShape body;
     		
 		Enemy();
-		void Move();
-		void Draw(sf::RenderWindow &window);
-		void CheckCollision(sf::RenderWindow &w);
+		void Draw(sf::RenderWindow &window, float x, float y);
+		//on screen box of an enemy centred at (x, y)
+		static sf::FloatRect Bounds(float x, float y);
 };
 
+#endif
@@ -0,0 +1,77 @@
+#include "entitystore.hpp"
+#include "integrate.hpp"
+#include "config.hpp"
+
+EntityStore::EntityStore(int capacity, PoolPolicy p, int chunk)
+	: freeHead(-1), growBy(chunk>0 ? chunk : capacity), policy(p), count(0), rejected(0){
+	x.resize(capacity);
+	y.resize(capacity);
+	vx.resize(capacity);
+	next.resize(capacity);
+	active.resize((capacity+63)/64);
+	cull.resize(active.size());
+	Link(0);
+}
+
+void EntityStore::Link(int first){
+	//chain slots [first, capacity) onto the front of the free list,
+	//lowest index first
+	for(int i = Capacity()-1; i>=first; i--){
+		next[i] = freeHead;
+		freeHead = i;
+	}
+}
+
+int EntityStore::Spawn(float px, float py, float pvx){
+	if(freeHead<0){
+		if(policy==PoolReject || growBy<=0){
+			rejected++;
+			return -1;
+		}
+		int old = Capacity();
+		x.resize(old + growBy);
+		y.resize(old + growBy);
+		vx.resize(old + growBy);
+		next.resize(old + growBy);
+		active.resize((Capacity()+63)/64);
+		cull.resize(active.size());
+		Link(old);
+	}
+	int i = freeHead;
+	freeHead = next[i];
+	x[i] = px;
+	y[i] = py;
+	vx[i] = pvx;
+	active[i>>6] |= (uint64_t)1<<(i&63);
+	count++;
+	return i;
+}
+
+void EntityStore::Kill(int i){
+	if(!IsActive(i))
+		return;
+	active[i>>6] &= ~((uint64_t)1<<(i&63));
+	next[i] = freeHead;
+	freeHead = i;
+	count--;
+}
+
+void EntityStore::Integrate(float minX, float maxX, JobSystem *jobs){
+	//each chunk starts on a multiple of 64, so chunks write disjoint
+	//words of cull
+	auto kernel = [&](int begin, int end){
+		::Integrate(x.data()+begin, vx.data()+begin, end-begin, minX, maxX, cull.data()+(begin>>6));
+	};
+	if(jobs)
+		jobs->ParallelFor(Capacity(), JOB_CHUNK, kernel);
+	else
+		kernel(0, Capacity());
+
+	for(int w = 0; w<(int)active.size(); w++){
+		uint64_t dead = cull[w] & active[w];
+		while(dead){
+			Kill((w<<6) + __builtin_ctzll(dead));
+			dead &= dead-1;
+		}
+	}
+}
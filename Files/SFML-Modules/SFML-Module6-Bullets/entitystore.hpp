@@ -0,0 +1,73 @@
+#ifndef ENTITYSTORE_HPP
+#define ENTITYSTORE_HPP
+
+#include <vector>
+#include <stdint.h>
+#include "jobs.hpp"
+
+//What Spawn does when every slot is already in use.
+enum PoolPolicy{PoolGrow, PoolReject};
+
+//Structure-of-arrays storage for a pool of moving entities.
+//Each column is its own contiguous array, so a loop that only moves
+//things touches x[] and vx[] and nothing else; the sf::RectangleShape
+//used to draw them is shared and only positioned at draw time.
+//Free slots are chained through next[] so Spawn and Kill are O(1).
+class EntityStore{
+	private:
+		std::vector<int> next;
+		int freeHead;
+		int growBy;
+		PoolPolicy policy;
+		int count;
+		long rejected;
+		//scratch mask filled by the integrate kernel
+		std::vector<uint64_t> cull;
+
+		void Link(int first);
+	public:
+		std::vector<float> x, y, vx;
+		//one bit per slot, set while the entity is alive
+		std::vector<uint64_t> active;
+
+		EntityStore(int capacity, PoolPolicy p = PoolGrow, int chunk = 0);
+
+		//slot of a new entity, or -1 if full under PoolReject
+		int Spawn(float px, float py, float pvx);
+		//free slot i; killing a dead slot does nothing
+		void Kill(int i);
+		bool IsActive(int i) const{
+			return (active[i>>6]>>(i&63))&1;
+		}
+
+		//x += vx for every entity, killing the live ones that leave
+		//the (minX, maxX) strip. Dead slots are moved too: that keeps
+		//the loop branch free for the SIMD kernel and Spawn resets
+		//them anyway. With jobs the kernel runs in JOB_CHUNK pieces
+		//across threads; the kills are always done afterwards in order.
+		void Integrate(float minX, float maxX, JobSystem *jobs = NULL);
+
+		int Capacity() const{ return (int)x.size(); }
+		int ActiveCount() const{ return count; }
+		//number of Spawn calls turned away under PoolReject
+		long Rejected() const{ return rejected; }
+
+		//call f(i) for every live slot, skipping 64 dead ones at a time
+		template<class F> void ForEach(F f) const{
+			ForEach(0, Capacity(), f);
+		}
+		//same, for slots in [first, last); first has to be a multiple
+		//of 64 and last either one too or the capacity
+		template<class F> void ForEach(int first, int last, F f) const{
+			for(int w = first>>6; w<(last+63)>>6; w++){
+				uint64_t bits = active[w];
+				while(bits){
+					int i = (w<<6) + __builtin_ctzll(bits);
+					bits &= bits-1;
+					f(i);
+				}
+			}
+		}
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "events.hpp"
+
+CollisionQueue::CollisionQueue(uint32_t capacity){
+	uint32_t size = 1;
+	while(size<capacity)
+		size <<= 1;
+	ring.resize(size);
+	mask = size-1;
+	head = tail = 0;
+	dropped = 0;
+}
+
+void CollisionQueue::Reserve(uint32_t capacity){
+	if(capacity<=Capacity())
+		return;
+	long lost = dropped;
+	*this = CollisionQueue(capacity);
+	dropped = lost;
+}
+
+bool CollisionQueue::Push(uint8_t type, int enemy, int bullet){
+	if(Size()>mask){
+		dropped++;
+		return false;
+	}
+	CollisionEvent &e = ring[tail & mask];
+	e.type = type;
+	e.enemy = enemy;
+	e.bullet = bullet;
+	tail++;
+	return true;
+}
+
+bool CollisionQueue::Pop(CollisionEvent &e){
+	if(head==tail)
+		return false;
+	e = ring[head & mask];
+	head++;
+	return true;
+}
@@ -0,0 +1,41 @@
+#ifndef EVENTS_HPP
+#define EVENTS_HPP
+
+#include <vector>
+#include <stdint.h>
+
+enum CollisionType{EnemyHitPlayer, BulletHitEnemy};
+
+//One overlap found by the test phase. enemy/bullet are slots in the
+//Pool's and Player's EntityStores; bullet is unused for EnemyHitPlayer.
+struct CollisionEvent{
+	uint8_t type;
+	int enemy;
+	int bullet;
+};
+
+//Fixed-size ring buffer the collision tests push into and the resolve
+//stage drains. Nothing is allocated after construction; if a tick finds
+//more overlaps than fit, the extra ones are dropped and counted. Every
+//enemy and bullet queues at most one event a tick, so a queue with a
+//slot for each never drops anything.
+class CollisionQueue{
+	private:
+		std::vector<CollisionEvent> ring;
+		uint32_t mask;
+		uint32_t head, tail;
+		long dropped;
+	public:
+		//capacity is rounded up to a power of two
+		CollisionQueue(uint32_t capacity);
+		//make room for at least capacity events; this allocates only
+		//if it has to grow, and the queue must be empty
+		void Reserve(uint32_t capacity);
+		bool Push(uint8_t type, int enemy, int bullet);
+		bool Pop(CollisionEvent &e);
+		uint32_t Size() const{ return tail - head; }
+		uint32_t Capacity() const{ return mask + 1; }
+		long Dropped() const{ return dropped; }
+};
+
+#endif
@@ -0,0 +1,40 @@
+#include "grid.hpp"
+
+Grid::Grid(int height){
+	rows = (height + PSIZE - 1)/PSIZE;
+	if(rows<1)
+		rows = 1;
+	cellStart.assign(rows*GRIDDIM + 1, 0);
+}
+
+int Grid::CellOf(float v, int cells){
+	int c = (int)(v/PSIZE);
+	if(v<0 || c<0)
+		return 0;
+	if(c>=cells)
+		return cells-1;
+	return c;
+}
+
+void Grid::Build(const EntityStore &enemies){
+	//counting sort: count per cell, prefix sum, then scatter
+	const int cells = rows*GRIDDIM;
+	if((int)items.size()<enemies.Capacity())
+		items.resize(enemies.Capacity());
+	for(int c = 0; c<=cells; c++)
+		cellStart[c] = 0;
+	enemies.ForEach([&](int i){
+		cellStart[CellOf(enemies.y[i], rows)*GRIDDIM + CellOf(enemies.x[i], GRIDDIM) + 1]++;
+	});
+	for(int c = 0; c<cells; c++)
+		cellStart[c+1] += cellStart[c];
+
+	//cellStart[c] is used as the write cursor for cell c, which leaves
+	//it pointing at the start of cell c+1; shift back afterwards
+	enemies.ForEach([&](int i){
+		items[cellStart[CellOf(enemies.y[i], rows)*GRIDDIM + CellOf(enemies.x[i], GRIDDIM)]++] = i;
+	});
+	for(int c = cells; c>0; c--)
+		cellStart[c] = cellStart[c-1];
+	cellStart[0] = 0;
+}
@@ -0,0 +1,51 @@
+#ifndef GRID_HPP
+#define GRID_HPP
+
+#include <vector>
+#include "config.hpp"
+#include "entitystore.hpp"
+
+//Broad-phase for bullet vs enemy collision.
+//The world is cut into PSIZE x PSIZE cells and every active enemy is
+//bucketed by the cell its centre is in. A bullet then only has to look
+//at the enemies in its own cell and the eight around it instead of the
+//whole pool. Anything outside is clamped into the border cells.
+//The world is WSIZE wide; the height defaults to the window's but
+//stress runs stretch it to keep the crowd from piling up.
+#define GRIDDIM ((WSIZE + PSIZE - 1)/PSIZE)
+
+class Grid{
+	private:
+		int rows;
+		//enemies in cell c are items[cellStart[c]] .. items[cellStart[c+1]-1]
+		std::vector<int> cellStart;
+		std::vector<int> items;
+	public:
+		Grid(int height = WSIZE);
+		//cell v falls in along an axis cut into cells of them
+		static int CellOf(float v, int cells);
+		//rebuild the buckets from the active enemies, once per tick
+		void Build(const EntityStore &enemies);
+
+		//call f(index) for every enemy bucketed near (x, y)
+		template<class F> void Query(float x, float y, F f) const{
+			Query(x, y, x, y, f);
+		}
+		//call f(index) for every enemy bucketed near the box from
+		//(x0, y0) to (x1, y1), e.g. the path a bullet took this tick
+		template<class F> void Query(float x0, float y0, float x1, float y1, F f) const{
+			int cx0 = CellOf(x0 < x1 ? x0 : x1, GRIDDIM), cx1 = CellOf(x0 < x1 ? x1 : x0, GRIDDIM);
+			int cy0 = CellOf(y0 < y1 ? y0 : y1, rows), cy1 = CellOf(y0 < y1 ? y1 : y0, rows);
+			for(int gy = cy0-1; gy<=cy1+1; gy++){
+				if(gy<0 || gy>=rows)
+					continue;
+				int first = gy*GRIDDIM + (cx0>0 ? cx0-1 : 0);
+				int last = gy*GRIDDIM + (cx1<GRIDDIM-1 ? cx1+1 : GRIDDIM-1);
+				//cells in a row are contiguous, so their buckets are too
+				for(int i = cellStart[first]; i<cellStart[last+1]; i++)
+					f(items[i]);
+			}
+		}
+};
+
+#endif
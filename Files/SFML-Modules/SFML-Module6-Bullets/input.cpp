@@ -0,0 +1,75 @@
+#include "input.hpp"
+
+Input::Input(){
+	state = InputState();
+	frames = 0;
+	events = 0;
+	perEventReads = 0;
+}
+
+void Input::Subscribe(std::function<void(const InputEvent &)> f){
+	subscribers.push_back(f);
+}
+
+void Input::Frame(sf::RenderWindow &window){
+	sf::Event event;
+	long arrived = 0;
+	while(window.pollEvent(event)){
+		arrived++;
+		InputEvent e = InputEvent();
+		switch(event.type){
+			case sf::Event::KeyPressed:
+			case sf::Event::KeyReleased:
+				e.type = (event.type==sf::Event::KeyPressed) ? KeyDown : KeyUp;
+				e.key = event.key.code;
+				break;
+			case sf::Event::MouseButtonPressed:
+			case sf::Event::MouseButtonReleased:
+				e.type = (event.type==sf::Event::MouseButtonPressed) ? MouseDown : MouseUp;
+				e.button = event.mouseButton.button;
+				e.mouse = sf::Vector2i(event.mouseButton.x, event.mouseButton.y);
+				break;
+			case sf::Event::Closed:
+				e.type = WindowClosed;
+				break;
+			default:
+				//mouse moves and the rest carry nothing we use
+				continue;
+		}
+		for(auto &f : subscribers)
+			f(e);
+	}
+
+	frames++;
+	state.left = sf::Keyboard::isKeyPressed(sf::Keyboard::Left);
+	state.right = sf::Keyboard::isKeyPressed(sf::Keyboard::Right);
+	state.up = sf::Keyboard::isKeyPressed(sf::Keyboard::Up);
+	state.down = sf::Keyboard::isKeyPressed(sf::Keyboard::Down);
+	state.fire = sf::Keyboard::isKeyPressed(sf::Keyboard::Space);
+	state.mouseLeft = sf::Mouse::isButtonPressed(sf::Mouse::Left);
+	state.mouse = sf::Mouse::getPosition(window);
+
+	//what the old loop would have queried for each of those events, with
+	//the devices as they are now: Button's click check (and the position
+	//if it's down), ReadInput's arrow chain up to the first key held,
+	//then its mouse and space checks
+	int arrows = state.left ? 1 : state.right ? 2 : state.up ? 3 : 4;
+	events += arrived;
+	perEventReads += arrived*(1 + state.mouseLeft + arrows + 2);
+}
+
+const InputState & Input::State() const{
+	return state;
+}
+
+long Input::Events() const{
+	return events;
+}
+
+long Input::Reads() const{
+	return frames*INPUT_READS;
+}
+
+long Input::PerEventReads() const{
+	return perEventReads;
+}
@@ -0,0 +1,52 @@
+#ifndef INPUT_HPP
+#define INPUT_HPP
+
+#include <SFML/Graphics.hpp>
+#include <functional>
+#include <vector>
+
+//The keyboard and mouse as read once at the start of a frame.
+struct InputState{
+	bool left, right, up, down, fire;
+	bool mouseLeft;
+	sf::Vector2i mouse;
+};
+
+enum InputEventType{KeyDown, KeyUp, MouseDown, MouseUp, WindowClosed};
+
+//One window event, boiled down to what the game listens for.
+struct InputEvent{
+	InputEventType type;
+	sf::Keyboard::Key key;
+	sf::Mouse::Button button;
+	sf::Vector2i mouse;
+};
+
+//device queries one InputState costs: five keys, a button, the position
+#define INPUT_READS 7
+
+//Pumps the window's events once per frame. Each event goes out to the
+//subscribers as an InputEvent; held keys come from State(), which is read
+//from the devices once per frame, however many events arrived. Before,
+//every event made Player and Button poll the devices again.
+class Input{
+	private:
+		std::vector<std::function<void(const InputEvent &)>> subscribers;
+		InputState state;
+		long frames, events, perEventReads;
+	public:
+		Input();
+		void Subscribe(std::function<void(const InputEvent &)> f);
+		//drain the window's queue, dispatch, then snapshot the devices
+		void Frame(sf::RenderWindow &window);
+		const InputState & State() const;
+
+		//events seen, device queries made, and the queries polling on
+		//every event (Player's read plus Button's, each time) would
+		//have made, counted from each frame's device state
+		long Events() const;
+		long Reads() const;
+		long PerEventReads() const;
+};
+
+#endif
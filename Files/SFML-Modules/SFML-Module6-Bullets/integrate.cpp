@@ -0,0 +1,85 @@
+#include "integrate.hpp"
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+//finish the kernel one float at a time from i, for the tail the vector
+//loops can't cover
+static void Tail(float *x, const float *vx, int i, int n, float minX, float maxX, uint64_t *cull){
+	for(; i<n; i++){
+		x[i] += vx[i];
+		if(x[i]<=minX || x[i]>=maxX)
+			cull[i>>6] |= (uint64_t)1<<(i&63);
+	}
+}
+
+void IntegrateScalar(float *x, const float *vx, int n, float minX, float maxX, uint64_t *cull){
+	for(int w = 0; w<(n+63)/64; w++)
+		cull[w] = 0;
+	Tail(x, vx, 0, n, minX, maxX, cull);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+void IntegrateSSE2(float *x, const float *vx, int n, float minX, float maxX, uint64_t *cull){
+	__m128 lo = _mm_set1_ps(minX), hi = _mm_set1_ps(maxX);
+	int full = n & ~63;
+	//16 groups of 4 floats fill one 64-bit word of the mask
+	for(int i = 0; i<full; i += 64){
+		uint64_t word = 0;
+		for(int j = 0; j<64; j += 4){
+			__m128 p = _mm_add_ps(_mm_loadu_ps(x+i+j), _mm_loadu_ps(vx+i+j));
+			_mm_storeu_ps(x+i+j, p);
+			__m128 out = _mm_or_ps(_mm_cmple_ps(p, lo), _mm_cmpge_ps(p, hi));
+			word |= (uint64_t)_mm_movemask_ps(out)<<j;
+		}
+		cull[i>>6] = word;
+	}
+	if(full<n)
+		cull[full>>6] = 0;
+	Tail(x, vx, full, n, minX, maxX, cull);
+}
+
+__attribute__((target("avx2")))
+void IntegrateAVX2(float *x, const float *vx, int n, float minX, float maxX, uint64_t *cull){
+	__m256 lo = _mm256_set1_ps(minX), hi = _mm256_set1_ps(maxX);
+	int full = n & ~63;
+	//8 groups of 8 floats fill one 64-bit word of the mask
+	for(int i = 0; i<full; i += 64){
+		uint64_t word = 0;
+		for(int j = 0; j<64; j += 8){
+			__m256 p = _mm256_add_ps(_mm256_loadu_ps(x+i+j), _mm256_loadu_ps(vx+i+j));
+			_mm256_storeu_ps(x+i+j, p);
+			__m256 out = _mm256_or_ps(_mm256_cmp_ps(p, lo, _CMP_LE_OQ), _mm256_cmp_ps(p, hi, _CMP_GE_OQ));
+			word |= (uint64_t)(uint32_t)_mm256_movemask_ps(out)<<j;
+		}
+		cull[i>>6] = word;
+	}
+	if(full<n)
+		cull[full>>6] = 0;
+	Tail(x, vx, full, n, minX, maxX, cull);
+}
+#endif
+
+void Integrate(float *x, const float *vx, int n, float minX, float maxX, uint64_t *cull){
+#if defined(INTEGRATE_SCALAR)
+	IntegrateScalar(x, vx, n, minX, maxX, cull);
+#elif defined(__AVX2__)
+	IntegrateAVX2(x, vx, n, minX, maxX, cull);
+#elif defined(__SSE2__)
+	IntegrateSSE2(x, vx, n, minX, maxX, cull);
+#else
+	IntegrateScalar(x, vx, n, minX, maxX, cull);
+#endif
+}
+
+const char *IntegrateISA(){
+#if defined(INTEGRATE_SCALAR)
+	return "scalar";
+#elif defined(__AVX2__)
+	return "avx2";
+#elif defined(__SSE2__)
+	return "sse2";
+#else
+	return "scalar";
+#endif
+}
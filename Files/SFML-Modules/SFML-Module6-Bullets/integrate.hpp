@@ -0,0 +1,27 @@
+#ifndef INTEGRATE_HPP
+#define INTEGRATE_HPP
+
+#include <stdint.h>
+
+//Position integration kernels used by EntityStore::Integrate.
+//Each one does x[i] += vx[i] for every i in [0, n) and sets bit i of
+//cull (n/64 rounded up words, cleared by the kernel) when the new x is
+//outside the (minX, maxX) strip, all in a single pass.
+//
+//Which one Integrate() calls is fixed at compile time: AVX2 if the
+//compiler targets it (-mavx2 / -march=native), else SSE2 on x86, else
+//scalar. Build with -DINTEGRATE_SCALAR to force the scalar loop.
+typedef void (*IntegrateKernel)(float *x, const float *vx, int n,
+		float minX, float maxX, uint64_t *cull);
+
+void IntegrateScalar(float *x, const float *vx, int n, float minX, float maxX, uint64_t *cull);
+#if defined(__x86_64__) || defined(__i386__)
+void IntegrateSSE2(float *x, const float *vx, int n, float minX, float maxX, uint64_t *cull);
+void IntegrateAVX2(float *x, const float *vx, int n, float minX, float maxX, uint64_t *cull);
+#endif
+
+//the compile-time choice
+void Integrate(float *x, const float *vx, int n, float minX, float maxX, uint64_t *cull);
+const char *IntegrateISA();
+
+#endif
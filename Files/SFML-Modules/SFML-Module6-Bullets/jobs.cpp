@@ -0,0 +1,105 @@
+#include "jobs.hpp"
+
+JobSystem::JobSystem(int workers) : queued(0), pending(0), quit(false){
+	if(workers<0){
+		int cores = (int)std::thread::hardware_concurrency();
+		workers = cores>1 ? cores-1 : 0;
+	}
+	for(int i = 0; i<=workers; i++)
+		queues.push_back(std::unique_ptr<Queue>(new Queue()));
+	for(int i = 1; i<=workers; i++)
+		threads.push_back(std::thread(&JobSystem::WorkerLoop, this, i));
+}
+
+JobSystem::~JobSystem(){
+	{
+		std::lock_guard<std::mutex> l(sleepLock);
+		quit = true;
+	}
+	wake.notify_all();
+	for(std::thread &t : threads)
+		t.join();
+}
+
+void JobSystem::Push(int q, const Job &job){
+	Queue &queue = *queues[q];
+	std::lock_guard<std::mutex> l(queue.lock);
+	//reuse the buffer once it has been drained
+	if(queue.head==(int)queue.jobs.size()){
+		queue.jobs.clear();
+		queue.head = 0;
+	}
+	queue.jobs.push_back(job);
+}
+
+bool JobSystem::Take(int self, Job &job){
+	//newest job from our own queue first, it's the one most likely
+	//to still be in cache
+	{
+		Queue &own = *queues[self];
+		std::lock_guard<std::mutex> l(own.lock);
+		if(own.head<(int)own.jobs.size()){
+			job = own.jobs.back();
+			own.jobs.pop_back();
+			queued--;
+			return true;
+		}
+	}
+	//then steal the oldest job from somebody else
+	for(int i = 1; i<(int)queues.size(); i++){
+		Queue &other = *queues[(self + i) % queues.size()];
+		std::lock_guard<std::mutex> l(other.lock);
+		if(other.head<(int)other.jobs.size()){
+			job = other.jobs[other.head++];
+			queued--;
+			return true;
+		}
+	}
+	return false;
+}
+
+void JobSystem::Run(const Job &job){
+	job.fn(job.ctx, job.begin, job.end);
+	pending.fetch_sub(1, std::memory_order_release);
+}
+
+void JobSystem::WorkerLoop(int self){
+	Job job;
+	while(true){
+		if(Take(self, job)){
+			Run(job);
+			continue;
+		}
+		std::unique_lock<std::mutex> l(sleepLock);
+		wake.wait(l, [&]{ return quit || queued>0; });
+		if(quit)
+			return;
+	}
+}
+
+void JobSystem::Dispatch(void (*fn)(void *, int, int), void *ctx, int n, int chunk){
+	int count = (n + chunk - 1)/chunk;
+	pending = count;
+	queued += count;
+	for(int j = 0; j<count; j++){
+		Job job;
+		job.fn = fn;
+		job.ctx = ctx;
+		job.begin = j*chunk;
+		job.end = (j+1)*chunk<n ? (j+1)*chunk : n;
+		Push(j % queues.size(), job);
+	}
+	{
+		std::lock_guard<std::mutex> l(sleepLock);
+	}
+	wake.notify_all();
+
+	//help out until every chunk is done
+	Job job;
+	while(pending.load(std::memory_order_acquire)>0){
+		if(Take(0, job))
+			Run(job);
+		else
+			std::this_thread::yield();
+	}
+}
@@ -0,0 +1,68 @@
+#ifndef JOBS_HPP
+#define JOBS_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//One chunk of a ParallelFor: run fn(ctx, begin, end).
+struct Job{
+	void (*fn)(void *ctx, int begin, int end);
+	void *ctx;
+	int begin, end;
+};
+
+//Small work-stealing job system.
+//Every thread (the workers plus the one calling ParallelFor, which is
+//queue 0) has its own deque of jobs. A thread takes from the back of its
+//own deque and, when that runs dry, steals from the front of the others.
+//ParallelFor returns only when every chunk has finished, so whatever the
+//chunks wrote is complete and visible afterwards.
+class JobSystem{
+	private:
+		struct Queue{
+			std::mutex lock;
+			std::vector<Job> jobs;
+			int head = 0;
+		};
+		std::vector<std::unique_ptr<Queue>> queues;
+		std::vector<std::thread> threads;
+		//jobs pushed but not taken yet, and jobs not finished yet
+		std::atomic<int> queued, pending;
+		std::atomic<bool> quit;
+		std::mutex sleepLock;
+		std::condition_variable wake;
+
+		void Push(int q, const Job &job);
+		bool Take(int self, Job &job);
+		void Run(const Job &job);
+		void WorkerLoop(int self);
+		void Dispatch(void (*fn)(void *, int, int), void *ctx, int n, int chunk);
+
+		template<class F> static void Call(void *ctx, int begin, int end){
+			(*(F *)ctx)(begin, end);
+		}
+	public:
+		//workers < 0 means one per core minus the calling thread
+		JobSystem(int workers = -1);
+		~JobSystem();
+		//threads that run jobs, counting the caller
+		int Threads(){ return (int)queues.size(); }
+
+		//call f(begin, end) over [0, n) in chunks of at most chunk,
+		//spread over all threads; runs inline if there's only one chunk
+		template<class F> void ParallelFor(int n, int chunk, F f){
+			if(n<=0)
+				return;
+			if(n<=chunk || threads.empty()){
+				f(0, n);
+				return;
+			}
+			Dispatch(Call<F>, &f, n, chunk);
+		}
+};
+
+#endif
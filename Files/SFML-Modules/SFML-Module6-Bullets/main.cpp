@@ -1,47 +1,136 @@
 #include <SFML/Graphics.hpp>
 #include "config.hpp"
 #include "player.hpp"
+#include "enemy.hpp"
+#include "bullet.hpp"
 #include "button.hpp"
 #include "bg.hpp"
+#include "batch.hpp"
+#include "sim.hpp"
+#include "profiler.hpp"
+#include "input.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <thread>
+#include <cstring>
+#include <cstdlib>
+#include <ctime>
+#include <string>
 
-int main()
+int main(int argc, char *argv[])
 {
+    //./app --headless --ticks=N runs the simulation without a window
+    //--seed=N fixes the spawns, --record=FILE saves the session and
+    //--replay=FILE plays a saved one back headless; --alloc-check runs
+    //--ticks=N warm ticks headless and fails if any of them allocate
+    bool headless = false;
+    long ticks = 100000;
+    unsigned seed = time(0);
+    std::string record, replay;
+    bool allocCheck = false;
+    for(int i = 1; i<argc; i++){
+	if(strcmp(argv[i], "--headless")==0)
+		headless = true;
+	else if(strncmp(argv[i], "--ticks=", 8)==0)
+		ticks = atol(argv[i]+8);
+	else if(strncmp(argv[i], "--seed=", 7)==0)
+		seed = strtoul(argv[i]+7, NULL, 10);
+	else if(strncmp(argv[i], "--record=", 9)==0)
+		record = argv[i]+9;
+	else if(strcmp(argv[i], "--alloc-check")==0)
+		allocCheck = true;
+	else if(strncmp(argv[i], "--replay=", 9)==0){
+		replay = argv[i]+9;
+		headless = true;
+	}else{
+		std::cout<<"usage: "<<argv[0]<<" [--headless [--ticks=N]] [--seed=N] [--record=FILE] [--replay=FILE] [--alloc-check]"<<std::endl;
+		return 1;
+	}
+    }
+    if(allocCheck)
+	return RunAllocCheck(10*TICKRATE, ticks);
+    if(headless)
+	return RunHeadless(ticks, seed, record, replay);
+
     sf::RenderWindow window(sf::VideoMode(WSIZE, WSIZE), "APP");
-    window.setFramerateLimit(60);
+    //drawing is no longer tied to the tick rate, so draw at whatever
+    //rate the display refreshes
+    window.setVerticalSyncEnabled(true);
 	
     BG bg;    
     Button b(48, 24, WSIZE-40, 20, sf::Color::Red);
-    Pool enemypool;
-    Player* p1 = Player::getInstance();
-	
- 
+    World world(seed);
+    Batch batch;
+    //render thread copies of the shapes; the sim thread owns the real player
+    sf::RectangleShape playerBody = world.player.body;
+    Enemy enemyShape;
+    Bullet bulletShape;
+
+    //the simulation runs on its own thread at TICKRATE and hands over
+    //snapshots; input goes the other way as InputBits
+    TripleBuffer snapshots;
+    std::atomic<unsigned> input(0);
+    std::atomic<bool> running(true);
+    Recorder rec;
+    if(!record.empty() && !rec.Open(record, seed))
+	std::cout<<"can't write "<<record<<std::endl;
+    std::thread sim(RunSimulation, std::ref(world), std::ref(snapshots), std::ref(input), std::ref(running), &rec);
+
+    sf::Vector2f lastPlayer = playerBody.getPosition(), prevPlayer = lastPlayer;
+    sf::Clock frameClock;
+#if PROFILE
+    ProfileOverlay overlay;
+#endif
+
+    Input devices;
+    devices.Subscribe([&](const InputEvent &e){
+	b.OnInput(e, window);
+	if (e.type == WindowClosed)
+		window.close();
+#if PROFILE
+	if (e.type == KeyDown && e.key == sf::Keyboard::F3)
+		overlay.visible = !overlay.visible;
+#endif
+    });
 
     while (window.isOpen())
     {
-        sf::Event event;
-        while (window.pollEvent(event))
-        {
-		
-		b.CheckEvent(window);		
-		p1->HandleEvent();	
-		
-		if (event.type == sf::Event::Closed)
-                	window.close();
-        }
-	//All moveables
-	p1->Move();
-	enemypool.SpawnEnemy();
-        enemypool.Move();
-	//check enemy collisons with player
-	enemypool.CheckCollision(window);
-	
-	//check bullet collisions with enemy
-	p1->CheckCollision(enemypool);
+	PROFILE_SCOPE(PhFrame);
+	{
+	PROFILE_SCOPE(PhEvents);
+	//events go to the subscribers; the devices are read once
+	devices.Frame(window);
+	input |= Player::ReadInput(devices.State());
+	}
+
+	//pick up the newest tick, remembering where the player was before
+	if(snapshots.Acquire()){
+		prevPlayer = lastPlayer;
+		lastPlayer = snapshots.Front().player;
+	}
+	const Snapshot &snap = snapshots.Front();
+	if(!snap.alive)
+		window.close();
+
+	//draw one tick behind and blend towards the newest snapshot, so
+	//motion stays smooth when frames and ticks don't line up
+	float alpha = 1;
+	if(snap.tick>=0){
+		alpha = std::chrono::duration<float>(std::chrono::steady_clock::now() - snap.time).count()/DT;
+		alpha = std::min(std::max(alpha, 0.0f), 1.0f);
+	}
+	float lag = 1 - alpha;
 
 	//move background
-	bg.move();	
+	{
+	PROFILE_SCOPE(PhBackground);
+	bg.move(frameClock.restart().asSeconds());	
+	}
 
+	{
+	PROFILE_SCOPE(PhDraw);
 	// Every frame clear the screen
         window.clear();
 	
@@ -54,11 +143,38 @@ int main()
 	window.draw(b.button);
 	
         //Player should be the last to be drawn
-	p1->Draw(window);
-	enemypool.Draw(window);
+	playerBody.setPosition(prevPlayer + (lastPlayer - prevPlayer)*alpha);
+	playerBody.setRotation(snap.playerRotation);
+	window.draw(playerBody);
+	//enemies and bullets all move in straight lines, so lag ticks
+	//ago they were lag*vx further back
+#if BATCH_DRAW
+	//bullets and enemies all go out in one draw call
+	batch.Clear();
+	batch.Add(snap.bullets, lag, bulletShape.body);
+	batch.Add(snap.enemies, lag, enemyShape.body);
+	batch.Draw(window);
+#else
+	for(int i = 0; i<snap.bullets.count; i++)
+		bulletShape.Draw(window, snap.bullets.x[i] - snap.bullets.vx[i]*lag, snap.bullets.y[i]);
+	for(int i = 0; i<snap.enemies.count; i++)
+		enemyShape.Draw(window, snap.enemies.x[i] - snap.enemies.vx[i]*lag, snap.enemies.y[i]);
+#endif
+#if PROFILE
+	overlay.Draw(window);
+#endif
+	}
 	//Every frame, display render changes
+	PROFILE_SCOPE(PhDisplay);
         window.display();
     }
 
+    running = false;
+    sim.join();
+    std::cout<<"input events: "<<devices.Events()<<", device reads: "<<devices.Reads()
+	<<" (polling per event: "<<devices.PerEventReads()<<")"<<std::endl;
+#if PROFILE
+    Profiler::WriteCSV(PROFILE_CSV);
+#endif
     return 0;
 }
@@ -1,50 +1,47 @@
 #include "player.hpp"
-Player* Player::instance = NULL;
+#include "bullet.hpp"
 
-Player::Player(){
+Player::Player(int bulletSlots) : bullets(bulletSlots, PoolReject){
 	body.setSize(sf::Vector2f(PSIZE, PSIZE));
 	body.setOrigin(PSIZE/2,PSIZE/2);
    	body.setPosition(WSIZE/2, WSIZE/2);
     	body.setFillColor(sf::Color::Green);
     	moveDir = Stop;
-	pclock.restart();
+	//the first shot waits one reload, as if one had just been fired
+	loaded = false;
 }
-Player* Player::getInstance(){
-	if(!instance)
-		instance = new Player();
-	return instance;
+unsigned Player::ReadInput(const InputState &in){
+	unsigned input = 0;
+	if (in.left)
+	    input |= InLeft;
+	else if (in.right)
+	    input |= InRight;
+	else if (in.up)
+	    input |= InUp;
+	else if (in.down)
+	    input |= InDown;
+	//left click stops
+	if (in.mouseLeft)
+		input |= InStop;
+	if (in.fire)
+		input |= InFire;
+	return input;
 }
-void Player::HandleEvent(){
-	if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left))
-	{
-	    // move left...
-	    moveDir = Left;
-	}
-	else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right))
-	{
-    	    // move right...
-	    moveDir = Right;
-	}else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up))
-	{
-    	    // move right...
-	    moveDir = Up;
-	}else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down))
-	{
-    	    // move right...
-	    moveDir = Down;
-	}
-	if (sf::Mouse::isButtonPressed(sf::Mouse::Left))
-	{
-    	   	// left click...
-		moveDir = Stop;					
-	}
-
-	if(sf::Keyboard::isKeyPressed(sf::Keyboard::Space)){
-		Attack();
-	}
-
+void Player::ApplyInput(unsigned input, TimerWheel &timers){
+	if(input & InLeft)
+		moveDir = Left;
+	else if(input & InRight)
+		moveDir = Right;
+	else if(input & InUp)
+		moveDir = Up;
+	else if(input & InDown)
+		moveDir = Down;
+	if(input & InStop)
+		moveDir = Stop;
+	if(input & InFire)
+		Attack(timers);
 }
-void Player::Move(){
+void Player::Move(JobSystem &jobs){
 	body.rotate(10);		
 	switch(moveDir){
 		case Left:
@@ -79,51 +76,60 @@ void Player::Move(){
 	}
 
 	//Also move player bullets if there are any active
-	for(int i = 0; i<20; i++)
-		bullet[i].Move();
+	bullets.Integrate(CULL_MIN, CULL_MAX, &jobs);
 
 	return;	
 }
-void Player::Draw(sf::RenderWindow &window){
-	window.draw(body);
-	
-	//also draw bullets if there are any active
-	for(int i = 0; i<20; i++)
-	bullet[i].Draw(window);
-
-
-	return;
-}
- 
-void Player::Damage(int x, sf::RenderWindow &window){
+void Player::Damage(int x){
 	health -=x;
-	if(health<=0)
-		window.close();
 }
-void Player::Attack(){
+bool Player::IsAlive(){
+	return health>0;
+}
+void Player::Respawn(){
+	health = 100;
+	moveDir = Stop;
+   	body.setPosition(WSIZE/2, WSIZE/2);
+}
+void Player::Attack(TimerWheel &timers){
 	//The user can only attack a certain amount of times per second
-	//use pclock to time when the attack is available
-	if(pclock.getElapsedTime().asSeconds()<0.25)
+	//a shot unloads the gun until its reload timer goes off
+	if(!loaded)
 		return;
 
 	
-	//find inactive bullet
-	Bullet *b;
-	for(int i=0; i<20; i++){
-		if(!bullet[i].isActive){
-			b = &bullet[i];
-			break;
-		}
-	}
+	//take an inactive bullet, if all are in flight skip this shot
 	//position bullet to player
-	b->body.setPosition(body.getPosition().x, body.getPosition().y);
-	//release bullet
-	b->isActive=true;
-	pclock.restart();
+	if(bullets.Spawn(body.getPosition().x, body.getPosition().y, BULLET_SPEED)<0)
+		return;
+	loaded = false;
+	timers.Schedule(RELOAD_TICKS, TimerReload);
+}
+void Player::Reload(){
+	loaded = true;
 }
-void Player::CheckCollision(Pool &pool){
+void Player::CheckCollision(Pool &pool, CollisionQueue &events, int first, int last){
 	//Check if any attacks hit the enemies
-	for(int i = 0; i<20;i++){
-		bullet[i].CheckCollision(pool);
-	}	
+	//only the enemies bucketed around a bullet can touch it
+	EntityStore &enemies = pool.GetPool();
+	const Grid &grid = pool.GetGrid();
+	//bullets are tested along the path they took this tick, so search
+	//everything that path (plus how far an enemy moves) could reach
+	const float reach = ENEMY_SPEED < 0 ? -ENEMY_SPEED : ENEMY_SPEED;
+	bullets.ForEach(first, last, [&](int b){
+		sf::Vector2f pos(bullets.x[b], bullets.y[b]), move(bullets.vx[b], 0);
+		float x0 = pos.x - move.x;
+		//a bullet is spent on the first enemy it reaches
+		bool hit = false;
+		grid.Query((x0 < pos.x ? x0 : pos.x) - reach, pos.y, (x0 < pos.x ? pos.x : x0) + reach, pos.y, [&](int e){
+			if(!hit && Bullet::Sweeps(pos, move, sf::Vector2f(enemies.x[e], enemies.y[e]), sf::Vector2f(enemies.vx[e], 0)))
+				hit = events.Push(BulletHitEnemy, e, b);
+		});
+	});	
+}
+EntityStore & Player::GetBullets(){
+	return bullets;
+}
+long Player::RejectedShots(){
+	return bullets.Rejected();
 }
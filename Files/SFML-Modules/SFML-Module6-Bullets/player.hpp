@@ -1,26 +1,46 @@
+#ifndef PLAYER_HPP
+#define PLAYER_HPP
+
 #include <SFML/Graphics.hpp>
 #include "config.hpp"
-#include "bullet.hpp"
+#include "entitystore.hpp"
+#include "pool.hpp"
+#include "events.hpp"
+#include "timers.hpp"
+#include "input.hpp"
 enum Dir{Left, Right, Up, Down, Stop};
+//One tick's worth of player input, as bits so it can be handed between
+//threads in a single atomic.
+enum InputBits{InLeft = 1, InRight = 2, InUp = 4, InDown = 8, InStop = 16, InFire = 32};
 
 class Player{
 	private:
-		static Player* instance;
 		int health = 100;
 		enum Dir moveDir;
-		Bullet bullet[20];
-		sf::Clock pclock;				
+		EntityStore bullets;
+		//false from a shot until its TimerReload goes off
+		bool loaded;
 	public:
     		sf::RectangleShape body;
- 		Player();
-		~Player();	
-		void HandleEvent();
-		void Move();
-		void Draw(sf::RenderWindow &window);
-		void Damage(int x,sf::RenderWindow &window);
-		void Attack();
-		void CheckCollision(Pool &p);
-		static Player* getInstance();
+ 		//bulletSlots caps how many shots can be in flight at once
+ 		Player(int bulletSlots = BULLET_POOL);
+		//turn this frame's keyboard and mouse into InputBits
+		static unsigned ReadInput(const InputState &in);
+		void ApplyInput(unsigned input, TimerWheel &timers);
+		void Move(JobSystem &jobs);
+		void Damage(int x);
+		bool IsAlive();
+		void Respawn();
+		//fire if loaded, and schedule the reload
+		void Attack(TimerWheel &timers);
+		void Reload();
+		//queue a BulletHitEnemy event for every overlap between an
+		//enemy and a bullet in slots [first, last)
+		void CheckCollision(Pool &p, CollisionQueue &events, int first, int last);
+		EntityStore & GetBullets();
+		//shots dropped because every bullet was already in flight
+		long RejectedShots();
 
 };
 
+#endif
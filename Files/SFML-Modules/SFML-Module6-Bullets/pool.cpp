@@ -1,54 +1,33 @@
 
 #include <SFML/Graphics.hpp>
 #include "pool.hpp"	
-#include <stdlib.h>
-#include <time.h>
+#include "enemy.hpp"
 
-Pool::Pool(){
-	srand(time(0));		
-	clock.restart();
-				
+Pool::Pool(unsigned seed, int height) : enemies(ENEMY_POOL, PoolGrow), grid(height), rng(seed){
 }
 void Pool::SpawnEnemy(){
-	Enemy *e;
-	if(clock.getElapsedTime().asSeconds() >= 1){
-		//get an inactive enemy
-		for(int i = 0; i<20; i++){
-			if(!ePool[i].isActive){
-				e = &ePool[i];
-				break;
-			}
-		}
-		//place it in the correct correct position
-		e->body.setPosition(WSIZE + 10, rand()%701 + 100);
-		//activate it
-		e->isActive = true;
-
-		//reset time
-		clock.restart();
-	}
-	
+	//place a free enemy in the correct correct position
+	enemies.Spawn(WSIZE + 10, rng.Range(100, 800), ENEMY_SPEED);
 }
-void Pool::Move(){
-	for(int i = 0; i<20; i++){
-		ePool[i].Move();	
-	}
+void Pool::Move(JobSystem & jobs){
+	//also frees the ones that went off screen
+	enemies.Integrate(CULL_MIN, CULL_MAX, &jobs);
 }
-void Pool::Draw(sf::RenderWindow & window){
-	for(int i = 0; i<20; i++){
-		ePool[i].Draw(window);
+void Pool::CheckCollision(const sf::FloatRect & player, CollisionQueue & events, int first, int last){
+	enemies.ForEach(first, last, [&](int i){
+		if(Enemy::Bounds(enemies.x[i], enemies.y[i]).intersects(player))
+			events.Push(EnemyHitPlayer, i, -1);
+	});
 
-	}
 }
 
-void Pool::CheckCollision(sf::RenderWindow & window){
-	for(int i = 0; i<20; i++){
-		ePool[i].CheckCollision(window);
-	}
 
+EntityStore & Pool::GetPool(){
+	return enemies; 
 }
-
-
-Enemy* Pool::GetPool(){
-	return ePool; 
+void Pool::BuildGrid(){
+	grid.Build(enemies);
+}
+const Grid & Pool::GetGrid(){
+	return grid;
 }
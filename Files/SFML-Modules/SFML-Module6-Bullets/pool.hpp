@@ -1,19 +1,35 @@
+#ifndef POOL_HPP
+#define POOL_HPP
 
 #include <SFML/Graphics.hpp>
 #include "config.hpp"
-#include "enemy.hpp"
+#include "entitystore.hpp"
+#include "grid.hpp"
+#include "events.hpp"
+#include "jobs.hpp"
+#include "rng.hpp"
 
 class Pool{
 	private:
-		Enemy ePool[20];
-		sf::Clock clock;
+		EntityStore enemies;
+		Grid grid;
+		Rng rng;
 	public:
-		Pool();
-		Enemy * GetPool();
+		//seed drives every random choice the pool makes, so the same
+		//seed and inputs give the same run; height is how tall the
+		//collision grid makes the world
+		Pool(unsigned seed, int height = WSIZE);
+		EntityStore & GetPool();
+		//place one enemy at the right edge; World calls it from a
+		//TimerSpawn timer
 		void SpawnEnemy();
-		void Move();
-		void Draw(sf::RenderWindow & window);
-		void CheckCollision(sf::RenderWindow & window);
+		void Move(JobSystem & jobs);
+		//queue an EnemyHitPlayer event for every enemy in slots
+		//[first, last) that touches player
+		void CheckCollision(const sf::FloatRect & player, CollisionQueue & events, int first, int last);
+		//bucket the active enemies for this tick's bullet checks
+		void BuildGrid();
+		const Grid & GetGrid();
 };
 
-
+#endif
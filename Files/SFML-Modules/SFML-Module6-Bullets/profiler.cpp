@@ -0,0 +1,108 @@
+#include "profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+std::atomic<uint32_t> Profiler::hist[PhaseCount][Profiler::Buckets];
+std::atomic<uint64_t> Profiler::count[PhaseCount];
+std::atomic<uint64_t> Profiler::total[PhaseCount];
+std::atomic<uint64_t> Profiler::worst[PhaseCount];
+
+const char *Profiler::Name(int phase){
+	static const char *names[PhaseCount] = {
+		"tick", "move", "spawn", "collide", "resolve",
+		"frame", "events", "background", "draw", "display"
+	};
+	return names[phase];
+}
+
+void Profiler::Record(int phase, uint64_t ns){
+	//bucket b covers [2^(b/8), 2^((b+1)/8)) ns
+	int b = ns>0 ? (int)(std::log2((double)ns)*8) : 0;
+	if(b>=Buckets)
+		b = Buckets-1;
+	hist[phase][b].fetch_add(1, std::memory_order_relaxed);
+	count[phase].fetch_add(1, std::memory_order_relaxed);
+	total[phase].fetch_add(ns, std::memory_order_relaxed);
+	uint64_t old = worst[phase].load(std::memory_order_relaxed);
+	while(ns>old && !worst[phase].compare_exchange_weak(old, ns, std::memory_order_relaxed))
+		;
+}
+
+uint64_t Profiler::Count(int phase){
+	return count[phase].load(std::memory_order_relaxed);
+}
+
+double Profiler::MeanMicros(int phase){
+	uint64_t n = Count(phase);
+	return n ? total[phase].load(std::memory_order_relaxed)/1000.0/n : 0;
+}
+
+double Profiler::PercentileMicros(int phase, double p){
+	uint64_t n = Count(phase);
+	if(n==0)
+		return 0;
+	uint64_t want = (uint64_t)std::ceil(p*n), seen = 0;
+	for(int b = 0; b<Buckets; b++){
+		seen += hist[phase][b].load(std::memory_order_relaxed);
+		if(seen>=want)
+			return std::min(std::pow(2.0, (b+1)/8.0)/1000.0, MaxMicros(phase));
+	}
+	return MaxMicros(phase);
+}
+
+double Profiler::MaxMicros(int phase){
+	return worst[phase].load(std::memory_order_relaxed)/1000.0;
+}
+
+std::string Profiler::Summary(){
+	std::string s = "phase        p50     p95     p99  (us)\n";
+	char line[96];
+	for(int p = 0; p<PhaseCount; p++){
+		snprintf(line, sizeof(line), "%-10s %7.1f %7.1f %7.1f\n", Name(p),
+			PercentileMicros(p, 0.50), PercentileMicros(p, 0.95), PercentileMicros(p, 0.99));
+		s += line;
+	}
+	return s;
+}
+
+bool Profiler::WriteCSV(const char *path){
+	FILE *f = fopen(path, "w");
+	if(!f)
+		return false;
+	fprintf(f, "phase,count,mean_us,p50_us,p95_us,p99_us,max_us\n");
+	for(int p = 0; p<PhaseCount; p++)
+		fprintf(f, "%s,%llu,%.3f,%.3f,%.3f,%.3f,%.3f\n", Name(p), (unsigned long long)Count(p),
+			MeanMicros(p), PercentileMicros(p, 0.50), PercentileMicros(p, 0.95),
+			PercentileMicros(p, 0.99), MaxMicros(p));
+	fclose(f);
+	return true;
+}
+
+ProfileOverlay::ProfileOverlay(){
+	font = Assets::GetFont("arial.ttf");
+	loaded = font!=NULL;
+	visible = true;
+	if(loaded)
+		text.setFont(*font);
+	text.setCharacterSize(14);
+	text.setFillColor(sf::Color::White);
+	text.setPosition(10, 10);
+	box.setFillColor(sf::Color(0, 0, 0, 160));
+	box.setPosition(5, 5);
+}
+
+void ProfileOverlay::Draw(sf::RenderWindow &window){
+	if(!loaded || !visible)
+		return;
+	//rebuilding the string every frame would cost more than some of
+	//the phases it reports
+	if(text.getString().isEmpty() || refresh.getElapsedTime().asSeconds()>=0.5){
+		text.setString(Profiler::Summary());
+		sf::FloatRect r = text.getLocalBounds();
+		box.setSize(sf::Vector2f(r.width + 20, r.height + 20));
+		refresh.restart();
+	}
+	window.draw(box);
+	window.draw(text);
+}
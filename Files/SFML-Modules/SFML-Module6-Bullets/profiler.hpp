@@ -0,0 +1,88 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include "config.hpp"
+#include "assets.hpp"
+
+//The parts of a frame we time. Sim phases run on the simulation thread,
+//the rest on the render thread; each phase is only ever recorded from
+//one thread.
+enum Phase{
+	PhTick, PhMove, PhSpawn, PhCollide, PhResolve,
+	PhFrame, PhEvents, PhBackground, PhDraw, PhDisplay,
+	PhaseCount
+};
+
+//Per-phase latency histograms. Buckets are spaced 8 per power of two of
+//nanoseconds (about 9% wide), so p50/p95/p99 come out of a fixed-size
+//table with no sorting and no allocation. Counters are relaxed atomics
+//so the overlay can read them from the render thread while the sim
+//thread is writing.
+class Profiler{
+	private:
+		static const int Buckets = 256;
+		static std::atomic<uint32_t> hist[PhaseCount][Buckets];
+		static std::atomic<uint64_t> count[PhaseCount];
+		static std::atomic<uint64_t> total[PhaseCount];
+		static std::atomic<uint64_t> worst[PhaseCount];
+	public:
+		static const char *Name(int phase);
+		static void Record(int phase, uint64_t ns);
+		static uint64_t Count(int phase);
+		static double MeanMicros(int phase);
+		//upper edge of the bucket holding the p-th fraction (capped at the
+		//max), in us
+		static double PercentileMicros(int phase, double p);
+		static double MaxMicros(int phase);
+
+		//one line per phase, for the overlay
+		static std::string Summary();
+		//phase,count,mean_us,p50_us,p95_us,p99_us,max_us
+		static bool WriteCSV(const char *path);
+};
+
+//Times from construction to the end of the enclosing scope.
+class ScopedTimer{
+	private:
+		int phase;
+		std::chrono::steady_clock::time_point start;
+	public:
+		ScopedTimer(int p) : phase(p), start(std::chrono::steady_clock::now()){}
+		~ScopedTimer(){
+			Profiler::Record(phase, std::chrono::duration_cast<std::chrono::nanoseconds>(
+				std::chrono::steady_clock::now() - start).count());
+		}
+};
+
+//PROFILE_SCOPE(PhMove) times the rest of the block. With PROFILE set to
+//0 in config.hpp it expands to nothing, so there is no cost at all.
+#if PROFILE
+#define PROFILE_JOIN2(a, b) a##b
+#define PROFILE_JOIN(a, b) PROFILE_JOIN2(a, b)
+#define PROFILE_SCOPE(phase) ScopedTimer PROFILE_JOIN(profileTimer, __LINE__)(phase)
+#else
+#define PROFILE_SCOPE(phase)
+#endif
+
+//Text box with Profiler::Summary(), refreshed a couple of times a
+//second. Needs arial.ttf next to the app; without it Draw does nothing.
+class ProfileOverlay{
+	private:
+		std::shared_ptr<sf::Font> font;
+		sf::Text text;
+		sf::RectangleShape box;
+		sf::Clock refresh;
+		bool loaded;
+	public:
+		bool visible;
+		ProfileOverlay();
+		void Draw(sf::RenderWindow &window);
+};
+
+#endif
@@ -0,0 +1,81 @@
+#include "replay.hpp"
+#include <string.h>
+
+static const char MAGIC[4] = {'M', '6', 'R', 'P'};
+static const uint8_t VERSION = 1;
+
+Recorder::Recorder(){
+	f = NULL;
+	mask = 0;
+	run = 0;
+}
+
+Recorder::~Recorder(){
+	Close();
+}
+
+bool Recorder::Open(const std::string &path, uint32_t seed){
+	Close();
+	f = fopen(path.c_str(), "wb");
+	if(!f)
+		return false;
+	uint8_t header[9];
+	memcpy(header, MAGIC, 4);
+	header[4] = VERSION;
+	for(int i = 0; i<4; i++)
+		header[5+i] = seed>>(8*i);
+	fwrite(header, 1, sizeof(header), f);
+	run = 0;
+	return true;
+}
+
+void Recorder::Flush(){
+	if(run==0)
+		return;
+	uint8_t rec[3] = {mask, (uint8_t)run, (uint8_t)(run>>8)};
+	fwrite(rec, 1, sizeof(rec), f);
+	run = 0;
+}
+
+void Recorder::Tick(unsigned input){
+	if(!f)
+		return;
+	if(run>0 && (input!=mask || run==0xffff))
+		Flush();
+	mask = input;
+	run++;
+}
+
+void Recorder::Close(){
+	if(!f)
+		return;
+	Flush();
+	fclose(f);
+	f = NULL;
+}
+
+Replay::Replay(){
+	seed = 0;
+}
+
+bool Replay::Load(const std::string &path){
+	FILE *f = fopen(path.c_str(), "rb");
+	if(!f)
+		return false;
+	uint8_t header[9];
+	bool ok = fread(header, 1, sizeof(header), f)==sizeof(header)
+		&& memcmp(header, MAGIC, 4)==0 && header[4]==VERSION;
+	if(ok){
+		seed = header[5] | header[6]<<8 | header[7]<<16 | (uint32_t)header[8]<<24;
+		inputs.clear();
+		uint8_t rec[3];
+		while(fread(rec, 1, sizeof(rec), f)==sizeof(rec))
+			inputs.insert(inputs.end(), rec[1] | rec[2]<<8, rec[0]);
+	}
+	fclose(f);
+	return ok;
+}
+
+long Replay::Ticks() const{
+	return inputs.size();
+}
@@ -0,0 +1,41 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//A session is the RNG seed plus the InputBits mask the simulation
+//applied on every tick; with both, Update reproduces the run exactly.
+//On disk: "M6RP", a version, the seed, then runs of (mask, ticks) so
+//long stretches of the same input cost 3 bytes.
+
+//Writes a session as it is played. Tick is called once per tick, from
+//the thread running the simulation.
+class Recorder{
+	private:
+		FILE *f;
+		uint8_t mask;
+		uint16_t run;
+		void Flush();
+	public:
+		Recorder();
+		~Recorder();
+		bool Open(const std::string &path, uint32_t seed);
+		void Tick(unsigned input);
+		//write the last run; also done by the destructor
+		void Close();
+};
+
+//A whole session read back into memory, one mask per tick.
+class Replay{
+	public:
+		uint32_t seed;
+		std::vector<uint8_t> inputs;
+		Replay();
+		bool Load(const std::string &path);
+		long Ticks() const;
+};
+
+#endif
@@ -0,0 +1,52 @@
+#include "rng.hpp"
+
+//splitmix64 spreads even a tiny seed like 1 over all 256 bits of state
+static uint64_t SplitMix(uint64_t &x){
+	uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+	z = (z ^ (z>>30))*0xbf58476d1ce4e5b9ull;
+	z = (z ^ (z>>27))*0x94d049bb133111ebull;
+	return z ^ (z>>31);
+}
+
+Rng::Rng(uint64_t seed){
+	Seed(seed);
+}
+
+void Rng::Seed(uint64_t seed){
+	for(int i = 0; i<4; i++)
+		s[i] = SplitMix(seed);
+}
+
+void Rng::Jump(){
+	static const uint64_t JUMP[] = {0x180ec6d33cfd0abaull, 0xd5a61266f0c9392cull,
+		0xa9582618e03fc9aaull, 0x39abdc4529b1661cull};
+	uint64_t t[4] = {0, 0, 0, 0};
+	for(int i = 0; i<4; i++)
+		for(int b = 0; b<64; b++){
+			if(JUMP[i] & (1ull<<b))
+				for(int j = 0; j<4; j++)
+					t[j] ^= s[j];
+			Next();
+		}
+	for(int j = 0; j<4; j++)
+		s[j] = t[j];
+}
+
+Rng Rng::Stream(int k) const{
+	Rng r = *this;
+	for(int i = 0; i<=k; i++)
+		r.Jump();
+	return r;
+}
+
+void Rng::Fill(int *out, int n, int lo, int hi){
+	uint32_t span = hi - lo + 1;
+	for(int i = 0; i<n; i++)
+		out[i] = lo + (int)Below(span);
+}
+
+void Rng::Fill(float *out, int n, float lo, float hi){
+	float span = hi - lo;
+	for(int i = 0; i<n; i++)
+		out[i] = lo + Float()*span;
+}
@@ -0,0 +1,55 @@
+#ifndef RNG_HPP
+#define RNG_HPP
+
+#include <stdint.h>
+
+//xoshiro256** generator. Unlike rand() it has no hidden global state:
+//each system owns its own Rng, so the same seed always gives the same
+//numbers no matter what else is drawing, and threads never share one.
+//Stream(k) hands out generators 2^128 draws apart, one per thread or
+//job, that can never overlap.
+class Rng{
+	private:
+		uint64_t s[4];
+		static uint64_t Rotl(uint64_t x, int k){
+			return (x<<k) | (x>>(64-k));
+		}
+	public:
+		Rng(uint64_t seed = 0);
+		void Seed(uint64_t seed);
+		//a copy of this generator moved k+1 jumps ahead
+		Rng Stream(int k) const;
+		//advance 2^128 draws
+		void Jump();
+
+		uint64_t Next(){
+			uint64_t result = Rotl(s[1]*5, 7)*9;
+			uint64_t t = s[1]<<17;
+			s[2] ^= s[0];
+			s[3] ^= s[1];
+			s[1] ^= s[2];
+			s[0] ^= s[3];
+			s[2] ^= t;
+			s[3] = Rotl(s[3], 45);
+			return result;
+		}
+		//0 to n-1 by multiply-shift, no division and no modulo bias
+		//worth caring about for n far below 2^32
+		uint32_t Below(uint32_t n){
+			return ((Next()>>32)*n)>>32;
+		}
+		//lo to hi inclusive
+		int Range(int lo, int hi){
+			return lo + (int)Below(hi - lo + 1);
+		}
+		//[0, 1)
+		float Float(){
+			return (Next()>>40)*(1.0f/16777216.0f);
+		}
+
+		//bulk versions for filling whole columns at once
+		void Fill(int *out, int n, int lo, int hi);
+		void Fill(float *out, int n, float lo, float hi);
+};
+
+#endif
@@ -0,0 +1,239 @@
+#include "sim.hpp"
+#include "profiler.hpp"
+#include "allocs.hpp"
+#include "batch.hpp"
+#include "enemy.hpp"
+#include "bullet.hpp"
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+World::World(unsigned seed, int bulletSlots, int height) : jobs(WORKERS), player(bulletSlots), pool(seed, height), events(ENEMY_POOL + bulletSlots){
+	timers.Schedule(SPAWN_TICKS, TimerSpawn);
+	timers.Schedule(RELOAD_TICKS, TimerReload);
+}
+
+void MoveAll(World &w){
+	{
+		PROFILE_SCOPE(PhSpawn);
+		w.timers.Advance([&](const Timer &t){
+			switch(t.type){
+				case TimerSpawn:
+					w.pool.SpawnEnemy();
+					w.timers.Schedule(SPAWN_TICKS, TimerSpawn);
+					break;
+				case TimerReload:
+					w.player.Reload();
+					break;
+			}
+		});
+	}
+	//All moveables
+	PROFILE_SCOPE(PhMove);
+	w.player.Move(w.jobs);
+	w.pool.Move(w.jobs);
+}
+
+int TestCollisions(World &w){
+	PROFILE_SCOPE(PhCollide);
+	int enemySlots = w.pool.GetPool().Capacity();
+	int bulletSlots = w.player.GetBullets().Capacity();
+	int enemyJobs = (enemySlots + JOB_CHUNK - 1)/JOB_CHUNK;
+	int bulletJobs = (bulletSlots + JOB_CHUNK - 1)/JOB_CHUNK;
+	//one event per slot at most, so a queue with room for the slots it
+	//covers never drops anything; they only grow while the pools do
+	while((int)w.jobEvents.size()<enemyJobs + bulletJobs)
+		w.jobEvents.push_back(CollisionQueue(JOB_CHUNK));
+	w.events.Reserve(enemySlots + bulletSlots);
+
+	//enemy collisons with player
+	sf::FloatRect player = w.player.body.getGlobalBounds();
+	//without workers a single job gets the whole range
+	w.jobs.ParallelFor(enemySlots, JOB_CHUNK, [&](int first, int last){
+		w.jobEvents[first/JOB_CHUNK].Reserve(last - first);
+		w.pool.CheckCollision(player, w.jobEvents[first/JOB_CHUNK], first, last);
+	});
+
+	//bullet collisions with enemy
+	w.pool.BuildGrid();
+	w.jobs.ParallelFor(bulletSlots, JOB_CHUNK, [&](int first, int last){
+		w.jobEvents[enemyJobs + first/JOB_CHUNK].Reserve(last - first);
+		w.player.CheckCollision(w.pool, w.jobEvents[enemyJobs + first/JOB_CHUNK], first, last);
+	});
+
+	//join: everything the jobs found, in job order
+	CollisionEvent e;
+	int found = 0;
+	for(int j = 0; j<enemyJobs + bulletJobs; j++){
+		found += w.jobEvents[j].Size();
+		while(w.jobEvents[j].Pop(e))
+			w.events.Push(e.type, e.enemy, e.bullet);
+	}
+	return found;
+}
+
+void ResolveCollisions(World &w){
+	PROFILE_SCOPE(PhResolve);
+	EntityStore &enemies = w.pool.GetPool();
+	EntityStore &bullets = w.player.GetBullets();
+	CollisionEvent e;
+	while(w.events.Pop(e)){
+		//an enemy can only be used up once; later overlaps with it
+		//this tick don't count
+		if(!enemies.IsActive(e.enemy))
+			continue;
+		enemies.Kill(e.enemy);
+		if(e.type==EnemyHitPlayer){
+			std::cout<<"collison"<<std::endl;
+			w.player.Damage(100);
+		}else{
+			bullets.Kill(e.bullet);
+		}
+	}
+}
+
+void Update(World &w){
+	PROFILE_SCOPE(PhTick);
+	MoveAll(w);
+	TestCollisions(w);
+	ResolveCollisions(w);
+}
+
+long DroppedCollisions(World &w){
+	long dropped = w.events.Dropped();
+	for(CollisionQueue &q : w.jobEvents)
+		dropped += q.Dropped();
+	return dropped;
+}
+
+void Capture(World &w, long tick, Snapshot &s){
+	s.tick = tick;
+	s.alive = w.player.IsAlive();
+	s.player = w.player.body.getPosition();
+	s.playerRotation = w.player.body.getRotation();
+	s.enemies.Fill(w.pool.GetPool());
+	s.bullets.Fill(w.player.GetBullets());
+	s.time = std::chrono::steady_clock::now();
+}
+
+void RunSimulation(World &w, TripleBuffer &out, std::atomic<unsigned> &input, std::atomic<bool> &running, Recorder *rec){
+	auto step = std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(DT));
+	auto next = std::chrono::steady_clock::now();
+	for(long tick = 0; running; tick++){
+		unsigned in = input.exchange(0);
+		if(rec)
+			rec->Tick(in);
+		w.player.ApplyInput(in, w.timers);
+		Update(w);
+		Capture(w, tick, out.Back());
+		out.Publish();
+
+		//fixed rate; if a tick ran long the next one starts at once
+		next += step;
+		std::this_thread::sleep_until(next);
+	}
+}
+
+int RunHeadless(long ticks, unsigned seed, const std::string &record, const std::string &replay){
+	Replay session;
+	if(!replay.empty()){
+		if(!session.Load(replay)){
+			std::cout<<"can't read replay "<<replay<<std::endl;
+			return 1;
+		}
+		seed = session.seed;
+		ticks = session.Ticks();
+		std::cout<<"replaying "<<replay<<std::endl;
+	}
+	Recorder rec;
+	if(!record.empty() && !rec.Open(record, seed)){
+		std::cout<<"can't write "<<record<<std::endl;
+		return 1;
+	}
+
+	World world(seed);
+	long deaths = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for(long t = 0; t<ticks; t++){
+		//nobody is at the keyboard, so keep the gun firing to
+		//exercise the bullet pool as well as the enemies
+		unsigned in = replay.empty() ? (unsigned)InFire : session.inputs[t];
+		rec.Tick(in);
+		world.player.ApplyInput(in, world.timers);
+		Update(world);
+		if(!world.player.IsAlive()){
+			deaths++;
+			world.player.Respawn();
+		}
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	double secs = std::chrono::duration<double>(end - start).count();
+	std::cout<<"seed: "<<seed<<std::endl;
+	std::cout<<"ticks: "<<ticks<<std::endl;
+	std::cout<<"simulated: "<<ticks*DT<<" s"<<std::endl;
+	std::cout<<"wall: "<<secs<<" s"<<std::endl;
+	std::cout<<"ticks/s: "<<(secs > 0 ? ticks/secs : 0)<<std::endl;
+	std::cout<<"deaths: "<<deaths<<std::endl;
+	std::cout<<"enemy pool: "<<world.pool.GetPool().Capacity()<<std::endl;
+	std::cout<<"shots rejected: "<<world.player.RejectedShots()<<std::endl;
+	long dropped = DroppedCollisions(world);
+	std::cout<<"collisions dropped: "<<dropped<<std::endl;
+#if PROFILE
+	if(Profiler::WriteCSV(PROFILE_CSV))
+		std::cout<<"profile: "<<PROFILE_CSV<<std::endl;
+#endif
+	//a dropped collision is a hit that never happened
+	return dropped>0 ? 1 : 0;
+}
+
+int RunAllocCheck(long warm, long ticks){
+	World world(1);
+	Snapshot snap;
+	Batch batch;
+	Enemy enemyShape;
+	Bullet bulletShape;
+	enum{Tick, Capt, Build, Phases};
+	const char *names[Phases] = {"update", "capture", "batch"};
+	long counts[Phases] = {0, 0, 0};
+	long warmup = Allocations();
+
+	for(long t = 0; t<warm + ticks; t++){
+		long before = Allocations();
+		world.player.ApplyInput(InFire, world.timers);
+		Update(world);
+		if(!world.player.IsAlive())
+			world.player.Respawn();
+		long afterTick = Allocations();
+		Capture(world, t, snap);
+		long afterCapture = Allocations();
+		batch.Clear();
+		batch.Add(snap.bullets, 0, bulletShape.body);
+		batch.Add(snap.enemies, 0, enemyShape.body);
+		long afterBuild = Allocations();
+		if(t==warm - 1)
+			warmup = Allocations() - warmup;
+		if(t>=warm){
+			counts[Tick] += afterTick - before;
+			counts[Capt] += afterCapture - afterTick;
+			counts[Build] += afterBuild - afterCapture;
+		}
+	}
+
+	long total = 0;
+	std::cout<<"allocations while warming up ("<<warm<<" ticks): "<<warmup<<std::endl;
+	std::cout<<"allocations over the next "<<ticks<<" ticks:"<<std::endl;
+	for(int p = 0; p<Phases; p++){
+		std::cout<<"  "<<names[p]<<": "<<counts[p]<<std::endl;
+		total += counts[p];
+	}
+#if !COUNT_ALLOCS
+	//nothing was counted, so a zero proves nothing
+	std::cout<<"COUNT_ALLOCS is 0, nothing was counted"<<std::endl;
+	std::cout<<"FAIL"<<std::endl;
+	return 1;
+#endif
+	std::cout<<(total==0 ? "PASS" : "FAIL")<<std::endl;
+	return total==0 ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+#ifndef SIM_HPP
+#define SIM_HPP
+
+#include "player.hpp"
+#include "pool.hpp"
+#include "events.hpp"
+#include "jobs.hpp"
+#include "snapshot.hpp"
+#include "replay.hpp"
+#include "timers.hpp"
+#include <atomic>
+#include <vector>
+
+//Everything the simulation owns. The window loop and the headless loop
+//each make one and step it with Update.
+struct World{
+	JobSystem jobs;
+	Player player;
+	Pool pool;
+	CollisionQueue events;
+	//spawns, reloads and anything else that happens N ticks from now
+	TimerWheel timers;
+	//one queue per collision job; merged into events in job order so
+	//the result doesn't depend on which thread ran what
+	std::vector<CollisionQueue> jobEvents;
+	//bulletSlots and height only need changing for stress runs
+	World(unsigned seed, int bulletSlots = BULLET_POOL, int height = WSIZE);
+};
+
+//The three phases of a tick, split out so each can be timed on its own.
+//Fire this tick's timers, move everything.
+void MoveAll(World &w);
+//Find every overlap and queue it; nothing is changed yet. Returns how
+//many the jobs found.
+int TestCollisions(World &w);
+//Apply the queued overlaps: kill enemies and bullets, damage the player.
+void ResolveCollisions(World &w);
+
+//Advance the world by one fixed tick (DT seconds).
+//The window loop and the headless loop both call this, so they run
+//exactly the same update sequence.
+void Update(World &w);
+
+//Collision events lost to full queues so far, counting the per-job
+//queues as well as the merged one.
+long DroppedCollisions(World &w);
+
+//Copy what the renderer needs out of the world.
+void Capture(World &w, long tick, Snapshot &s);
+
+//Body of the simulation thread: every DT seconds take the input the
+//render thread has gathered, run one Update and publish a snapshot,
+//until running goes false. Every tick's input also goes to rec, if given.
+void RunSimulation(World &w, TripleBuffer &out, std::atomic<unsigned> &input, std::atomic<bool> &running, Recorder *rec = NULL);
+
+//Run the simulation for the given number of ticks without opening a
+//window and print how many ticks per second it managed. With no
+//replay the player just holds fire; record (if not empty) saves the
+//session. replay (if not empty) instead runs the seed and inputs of a
+//recorded session, for as many ticks as it has. Returns 1 if any
+//collision was dropped.
+int RunHeadless(long ticks, unsigned seed, const std::string &record, const std::string &replay);
+
+//Run warm ticks to let every pool and buffer reach its working size,
+//then the given number of ticks and frames (Update, Capture and a batch
+//build, everything but the window) while counting heap allocations.
+//Prints the count for each phase; returns 1 if any of them allocated,
+//or if COUNT_ALLOCS is 0 and nothing could be counted.
+int RunAllocCheck(long warm, long ticks);
+
+#endif
@@ -0,0 +1,40 @@
+#include "snapshot.hpp"
+
+void EntityList::Fill(const EntityStore &store){
+	if((int)x.size()<store.ActiveCount()){
+		x.resize(store.ActiveCount());
+		y.resize(store.ActiveCount());
+		vx.resize(store.ActiveCount());
+	}
+	count = 0;
+	store.ForEach([&](int i){
+		x[count] = store.x[i];
+		y[count] = store.y[i];
+		vx[count] = store.vx[i];
+		count++;
+	});
+}
+
+TripleBuffer::TripleBuffer() : middle(1){
+	back = 0;
+	front = 2;
+}
+
+Snapshot & TripleBuffer::Back(){
+	return slots[back];
+}
+
+void TripleBuffer::Publish(){
+	back = middle.exchange(back | Fresh, std::memory_order_acq_rel) & ~Fresh;
+}
+
+bool TripleBuffer::Acquire(){
+	if(!(middle.load(std::memory_order_relaxed) & Fresh))
+		return false;
+	front = middle.exchange(front, std::memory_order_acq_rel) & ~Fresh;
+	return true;
+}
+
+const Snapshot & TripleBuffer::Front(){
+	return slots[front];
+}
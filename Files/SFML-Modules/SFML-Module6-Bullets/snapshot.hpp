@@ -0,0 +1,52 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include "entitystore.hpp"
+
+//The live entities of one EntityStore, packed. Only ever grows, so
+//copying a tick into it stops allocating after warm-up.
+struct EntityList{
+	std::vector<float> x, y, vx;
+	int count = 0;
+	void Fill(const EntityStore &store);
+};
+
+//Everything the renderer needs from one simulation tick. The sim thread
+//writes it and never touches it again once published.
+struct Snapshot{
+	long tick = -1;
+	//when the sim thread published it
+	std::chrono::steady_clock::time_point time;
+	bool alive = true;
+	sf::Vector2f player;
+	float playerRotation = 0;
+	EntityList enemies, bullets;
+};
+
+//Lock-free triple buffer between one writer and one reader.
+//The writer fills Back() and Publish()es it; the reader calls Acquire()
+//and reads Front(). Neither side ever waits for the other: there is
+//always a spare slot to write into and the reader keeps its slot until
+//it asks for a newer one.
+class TripleBuffer{
+	private:
+		Snapshot slots[3];
+		//index of the spare slot, plus Fresh if it holds a tick the
+		//reader hasn't seen
+		static const int Fresh = 4;
+		std::atomic<int> middle;
+		int back, front;
+	public:
+		TripleBuffer();
+		Snapshot & Back();
+		void Publish();
+		//swap in the newest published snapshot, true if there was one
+		bool Acquire();
+		const Snapshot & Front();
+};
+
+#endif
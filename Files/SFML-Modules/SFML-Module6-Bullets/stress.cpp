@@ -0,0 +1,130 @@
+#include <SFML/Graphics.hpp>
+#include "config.hpp"
+#include "sim.hpp"
+#include "batch.hpp"
+#include "enemy.hpp"
+#include "bullet.hpp"
+#include "integrate.hpp"
+#include "rng.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <stdlib.h>
+#include <string.h>
+
+//Headless stress driver: for each size, keep that many enemies and
+//bullets alive in a World and time the phases of every tick. The results
+//go to stdout as JSON so runs on different builds can be diffed or
+//graphed. ./stressapp E[:B]... picks the enemy and bullet counts; by
+//default enemies go from 100 to 100k with one bullet per ten enemies.
+//The world gets one window's height of room per thousand enemies so the
+//crowd stays as thick as a busy game instead of one solid overlap.
+//Exits 1 if any run dropped a collision.
+
+static double Micros(std::chrono::steady_clock::time_point start){
+	return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+struct Stat{
+	double total = 0, max = 0;
+	void Add(double us){
+		total += us;
+		max = std::max(max, us);
+	}
+};
+
+static void Field(const char *name, const Stat &s, int ticks, bool last = false){
+	std::cout<<"\""<<name<<"_us\": {\"mean\": "<<s.total/ticks<<", \"max\": "<<s.max<<"}"<<(last ? "" : ", ");
+}
+
+//top the stores back up to n; anything culled or killed comes back in
+//at the edge it moves away from
+static void Refill(EntityStore &store, int n, float x, float vx, int height, Rng &rng){
+	while(store.ActiveCount()<n)
+		store.Spawn(x, rng.Range(0, height), vx);
+}
+
+//true if nothing was dropped
+static bool Run(int n, int m, bool last){
+	const int ticks = std::max(3, std::min(300, 10000000/std::max(n, m)));
+	const int height = WSIZE*std::max(1, n/1000);
+	World w(1, m, height);
+	Rng rng(n);
+	EntityStore &enemies = w.pool.GetPool();
+	EntityStore &bullets = w.player.GetBullets();
+	for(int i = 0; i<n; i++)
+		enemies.Spawn(rng.Range(0, WSIZE), rng.Range(0, height), ENEMY_SPEED);
+	for(int i = 0; i<m; i++)
+		bullets.Spawn(rng.Range(0, WSIZE), rng.Range(0, height), BULLET_SPEED);
+	//keep the player well off screen so every collision measured is
+	//bullet against enemy and nothing gets printed
+	w.player.body.setPosition(-10*WSIZE, -10*WSIZE);
+
+	Snapshot snap;
+	Batch batch;
+	Enemy enemyShape;
+	Bullet bulletShape;
+	Stat update, collide, resolve, build;
+	long hits = 0;
+	for(int t = 0; t<ticks; t++){
+		Refill(enemies, n, WSIZE + 10, ENEMY_SPEED, height, rng);
+		Refill(bullets, m, 0, BULLET_SPEED, height, rng);
+
+		auto start = std::chrono::steady_clock::now();
+		MoveAll(w);
+		update.Add(Micros(start));
+
+		start = std::chrono::steady_clock::now();
+		hits += TestCollisions(w);
+		collide.Add(Micros(start));
+
+		start = std::chrono::steady_clock::now();
+		ResolveCollisions(w);
+		resolve.Add(Micros(start));
+
+		start = std::chrono::steady_clock::now();
+		Capture(w, t, snap);
+		batch.Clear();
+		batch.Add(snap.bullets, 0, bulletShape.body);
+		batch.Add(snap.enemies, 0, enemyShape.body);
+		build.Add(Micros(start));
+	}
+
+	long dropped = DroppedCollisions(w);
+	std::cout<<"    {\"enemies\": "<<n<<", \"bullets\": "<<m<<", \"height\": "<<height<<", \"ticks\": "<<ticks<<", ";
+	Field("update", update, ticks);
+	Field("collision", collide, ticks);
+	Field("resolve", resolve, ticks);
+	Field("batch_build", build, ticks);
+	std::cout<<"\"hits_per_tick\": "<<(double)hits/ticks<<", \"dropped\": "<<dropped<<"}"<<(last ? "" : ",")<<std::endl;
+	return dropped==0;
+}
+
+int main(int argc, char *argv[]){
+	std::vector<int> enemies, bullets;
+	for(int i = 1; i<argc; i++){
+		int e = atoi(argv[i]);
+		const char *colon = strchr(argv[i], ':');
+		if(e<=0)
+			continue;
+		enemies.push_back(e);
+		bullets.push_back(colon ? std::max(1, atoi(colon + 1)) : std::max(1, e/10));
+	}
+	if(enemies.empty())
+		for(int e = 100; e<=100000; e *= 10){
+			enemies.push_back(e);
+			bullets.push_back(e/10);
+		}
+
+	int threads = JobSystem(WORKERS).Threads();
+	std::cout<<"{"<<std::endl;
+	std::cout<<"  \"isa\": \""<<IntegrateISA()<<"\", \"threads\": "<<threads<<", \"tickrate\": "<<TICKRATE<<","<<std::endl;
+	std::cout<<"  \"runs\": ["<<std::endl;
+	bool clean = true;
+	for(size_t i = 0; i<enemies.size(); i++)
+		clean = Run(enemies[i], bullets[i], i + 1==enemies.size()) && clean;
+	std::cout<<"  ]"<<std::endl;
+	std::cout<<"}"<<std::endl;
+	return clean ? 0 : 1;
+}
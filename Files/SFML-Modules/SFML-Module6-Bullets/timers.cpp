@@ -0,0 +1,61 @@
+#include "timers.hpp"
+
+TimerWheel::TimerWheel(){
+	freeHead = -1;
+	now = 0;
+	pending = 0;
+	for(int l = 0; l<TIMERLEVELS; l++)
+		for(int s = 0; s<TIMERSLOTS; s++)
+			slots[l][s] = -1;
+}
+
+long TimerWheel::Now() const{
+	return now;
+}
+
+int TimerWheel::Pending() const{
+	return pending;
+}
+
+void TimerWheel::Insert(int n){
+	long delta = nodes[n].due - now;
+	int l = 0;
+	while(l<TIMERLEVELS - 1 && delta>=(1L<<(TIMERBITS*(l+1))))
+		l++;
+	int s = (nodes[n].due>>(TIMERBITS*l)) & (TIMERSLOTS - 1);
+	nodes[n].next = slots[l][s];
+	slots[l][s] = n;
+}
+
+void TimerWheel::Cascade(int level){
+	int s = (now>>(TIMERBITS*level)) & (TIMERSLOTS - 1);
+	int n = slots[level][s];
+	slots[level][s] = -1;
+	while(n>=0){
+		int next = nodes[n].next;
+		Insert(n);
+		n = next;
+	}
+}
+
+void TimerWheel::Schedule(long delay, uint8_t type, int data){
+	const long reach = (1L<<(TIMERBITS*TIMERLEVELS)) - 1;
+	if(delay<1)
+		delay = 1;
+	if(delay>reach)
+		delay = reach;
+
+	int n;
+	if(freeHead>=0){
+		n = freeHead;
+		freeHead = nodes[n].next;
+	}else{
+		n = nodes.size();
+		nodes.push_back(Node());
+	}
+	nodes[n].due = now + delay;
+	nodes[n].timer.type = type;
+	nodes[n].timer.data = data;
+	Insert(n);
+	pending++;
+}
@@ -0,0 +1,72 @@
+#ifndef TIMERS_HPP
+#define TIMERS_HPP
+
+#include <stdint.h>
+#include <vector>
+
+//What a timer does when it goes off; World::Update switches on it.
+enum TimerType{TimerSpawn, TimerReload};
+
+struct Timer{
+	uint8_t type;
+	int data;
+};
+
+//levels of TIMERSLOTS slots each; level l slots are TIMERSLOTS^l ticks
+//wide, so 4 levels of 64 reach 2^24 ticks (about 77 hours at 60 Hz)
+#define TIMERBITS 6
+#define TIMERSLOTS (1<<TIMERBITS)
+#define TIMERLEVELS 4
+
+//Hierarchical timing wheel counted in simulation ticks. Schedule drops
+//a timer straight into a slot and Advance only looks at the slot for
+//the new tick, so both are O(1) however many timers are waiting. Timers
+//far in the future sit in a coarser level and are moved down a level
+//each time the finer wheel wraps. Nodes come from a free list like
+//EntityStore, so once warm no timer allocates.
+class TimerWheel{
+	private:
+		struct Node{
+			long due;
+			Timer timer;
+			int next;
+		};
+		std::vector<Node> nodes;
+		int freeHead;
+		int slots[TIMERLEVELS][TIMERSLOTS];
+		long now;
+		int pending;
+		void Insert(int n);
+		//move every timer in one slot of a coarse level down
+		void Cascade(int level);
+	public:
+		TimerWheel();
+		long Now() const;
+		int Pending() const;
+		//go off delay ticks from now (at least 1, at most the wheel's
+		//reach)
+		void Schedule(long delay, uint8_t type, int data = 0);
+
+		//step to the next tick and call fire(const Timer &) for each
+		//timer due on it. fire may schedule new timers.
+		template<class F> void Advance(F fire){
+			now++;
+			for(int l = TIMERLEVELS - 1; l>0; l--)
+				if((now & ((1L<<(TIMERBITS*l)) - 1))==0)
+					Cascade(l);
+
+			int n = slots[0][now & (TIMERSLOTS - 1)];
+			slots[0][now & (TIMERSLOTS - 1)] = -1;
+			while(n>=0){
+				int next = nodes[n].next;
+				Timer t = nodes[n].timer;
+				nodes[n].next = freeHead;
+				freeHead = n;
+				pending--;
+				fire(t);
+				n = next;
+			}
+		}
+};
+
+#endif
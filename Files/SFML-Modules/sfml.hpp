@@ -0,0 +1,3 @@
+//Precompiled once per module by sfml.mk and force-included into every
+//object, so <SFML/Graphics.hpp> is parsed once instead of once per file.
+#include <SFML/Graphics.hpp>
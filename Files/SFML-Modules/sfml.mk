@@ -0,0 +1,50 @@
+# Shared build rules for the SFML modules. A module's makefile lists its
+# sources and includes this file:
+#
+#	SRC = main.cpp player.cpp button.cpp
+#	include ../sfml.mk
+#
+# `make` builds ./app and runs it. Every .cpp compiles to its own object
+# in $(OBJDIR), so an edit rebuilds only the objects it touches and
+# `make -j` can compile them side by side. -MMD writes each object's
+# header dependencies to a .d file next to it, so editing a header
+# rebuilds exactly the files that include it. <SFML/Graphics.hpp> is
+# precompiled once (sfml.hpp) and force-included into every object.
+
+OBJDIR ?= build
+LDLIBS += -lsfml-graphics -lsfml-window -lsfml-system
+
+SFMLMK := $(dir $(lastword $(MAKEFILE_LIST)))
+PCH := $(OBJDIR)/sfml.hpp
+
+# objects for a list of sources: $(call objects,main.cpp player.cpp)
+objects = $(addprefix $(OBJDIR)/,$(1:.cpp=.o))
+# link whatever objects the target depends on
+LINK = $(CXX) $(LDFLAGS) $^ -o $@ $(LDLIBS)
+
+.DEFAULT_GOAL := run
+
+run: app
+	./app
+
+app: $(call objects,$(SRC))
+	$(LINK)
+
+$(OBJDIR)/%.o: %.cpp $(PCH).gch
+	$(CXX) $(CXXFLAGS) -MMD -MP -include $(PCH) -c $< -o $@
+
+# the header is copied next to its .gch because that is where g++
+# looks for it; the .gch has to be built with the same flags
+$(PCH).gch: $(SFMLMK)sfml.hpp | $(OBJDIR)
+	cp $< $(PCH)
+	$(CXX) $(CXXFLAGS) -x c++-header $(PCH) -o $@
+
+$(OBJDIR):
+	mkdir -p $@
+
+clean:
+	rm -rf $(OBJDIR) app
+
+.PHONY: run clean
+
+-include $(wildcard $(OBJDIR)/*.d)